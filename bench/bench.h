@@ -0,0 +1,40 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/21 14:52:26 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 15:06:47 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#ifndef BENCH_H
+# define BENCH_H
+
+# include "philo.h"
+
+/* BENCH_DRINK : minuteur qui arrete un diner apres duration ms */
+typedef struct s_timer
+{
+	t_table	*table;
+	long	duration;
+}	t_timer;
+
+/* BENCH_SNAPSHOT : un ecrivain et les philos [from, to[ qu'il publie */
+typedef struct s_writer
+{
+	t_table		*table;
+	long		from;
+	long		to;
+	long		rate; // Changements d'etat par seconde et par philo
+	atomic_bool	*stop;
+}	t_writer;
+
+/* BENCH_DETECT */
+long	bench_trial(t_table *table, long victim);
+void	detect_row(t_table *table, long trials, long *lat);
+
+#endif
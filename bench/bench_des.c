@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_des.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:52:37 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 14:02:10 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/* Benchmark : passage a l'echelle du moteur DES (--des) avec le nombre
+de workers, sur un anneau de N philos (800 200 200, sans deces).
+Chaque execution doit donner la meme empreinte qu'avec un worker.
+Usage : ./bench/bench_des [N] [horizon ms] [workers max] */
+
+/**
+ * @brief Execute le moteur avec workers threads et affiche le temps.
+ * 
+ * @return L'empreinte de l'etat final
+ */
+unsigned long	bench_des(t_table *table, long horizon, int workers,
+	long *ref_us)
+{
+	t_des			des;
+	unsigned long	sum;
+	long			start;
+	long			us;
+
+	des_init(&des, table, workers, horizon);
+	start = get_time(MICROSECOND);
+	des_run(&des);
+	us = get_time(MICROSECOND) - start;
+	if (*ref_us == 0)
+		*ref_us = us;
+	sum = des_checksum(&des);
+	printf("N=%-8ld workers=%-3d %8.1f ms  %6.1f M philo-windows/s"
+		"  speedup %5.2f  stolen %ld\n", des.n, des.workers, us / 1e3,
+		des.n * des.windows / (double)us, *ref_us / (double)us,
+		des.w[0].stolen);
+	des_destroy(&des);
+	return (sum);
+}
+
+/**
+ * @brief Lit les arguments : N, horizon et nombre maximal de workers.
+ * 
+ * @return Le nombre maximal de workers
+ */
+int	bench_args(t_table *table, long *horizon, int ac, char **av)
+{
+	int	workers;
+
+	memset(table, 0, sizeof(t_table));
+	table->philo_nbr = 1000000;
+	table->time_to_die = 800 * MS_TO_US;
+	table->time_to_eat = 200 * MS_TO_US;
+	table->time_to_sleep = 200 * MS_TO_US;
+	table->nbr_limit_meals = -1;
+	*horizon = 10000;
+	if (ac > 1)
+		table->philo_nbr = atol(av[1]);
+	if (ac > 2)
+		*horizon = atol(av[2]);
+	workers = sysconf(_SC_NPROCESSORS_ONLN);
+	if (ac > 3)
+		workers = atoi(av[3]);
+	return (workers);
+}
+
+int	main(int ac, char **av)
+{
+	t_table			table;
+	unsigned long	ref;
+	long			ref_us;
+	long			horizon;
+	int				workers;
+	int				k;
+
+	workers = bench_args(&table, &horizon, ac, av);
+	ref_us = 0;
+	ref = bench_des(&table, horizon, 1, &ref_us);
+	k = 1;
+	while (++k <= workers)
+		if (bench_des(&table, horizon, k, &ref_us) != ref)
+			error("bench_des : result differs from 1 worker\n");
+	return (0);
+}
@@ -0,0 +1,110 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_detect.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 14:05:33 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 14:52:26 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "bench.h"
+
+/* Benchmark : latence de detection d'un deces, scan complet (un seul
+monitor, puis --shards=4 et --shards=16) contre --timerfd, de 10 a
+10 000 philos. Seul le monitor tourne : tous les
+philos ont mange "dans le futur" sauf une victime tiree au hasard, dont
+l'echeance tombe 50 ms apres le depart. La latence est l'ecart entre
+cette echeance et l'ecriture de la ligne "died".
+Usage : ./bench/bench_detect [essais par N] */
+
+/**
+ * @brief Callback : horodate la ligne "died" en microsecondes.
+ */
+void	bench_died(void *user, long time_ms, int id, t_philo_event event)
+{
+	(void)time_ms;
+	(void)id;
+	if (event == PHILO_DIED)
+		*(long *)user = get_time(MICROSECOND);
+}
+
+/**
+ * @brief Un essai : arme la table, lance le monitor, attend le deces.
+ * 
+ * @return Latence de detection (us)
+ */
+long	bench_trial(t_table *table, long victim)
+{
+	long	i;
+	long	now;
+	long	died;
+
+	data_reset(table);
+	table->opts.user = &died;
+	table->threads_running_nb = table->philo_nbr;
+	now = get_time(MILLISECOND);
+	table->start_simulation = now;
+	i = -1;
+	while (++i < table->philo_nbr)
+	{
+		table->philos[i].last_meal_time = now + 60000;
+		if (i == victim)
+			table->philos[i].last_meal_time = now;
+		snapshot_publish(table->philos + i, THINKING);
+		deadline_arm(table->philos + i);
+	}
+	safe_thread_handle(&table->monitor, monitor, table, CREATE);
+	safe_thread_handle(&table->monitor, NULL, NULL, JOIN);
+	return (died - (now + table->time_to_die / MS_TO_US + 1) * 1000);
+}
+
+/**
+ * @brief Toutes les lignes d'un N : scan a 1, 4 et 16 tranches, puis
+ * --timerfd.
+ */
+void	bench_modes(t_table *table, long trials, long *lat)
+{
+	table->opts.timerfd = false;
+	table->opts.shards = 1;
+	while (table->opts.shards <= 16)
+	{
+		detect_row(table, trials, lat);
+		table->opts.shards *= 4;
+	}
+	table->opts.shards = 1;
+	table->opts.timerfd = true;
+	detect_row(table, trials, lat);
+}
+
+int	main(int ac, char **av)
+{
+	t_table	table;
+	long	trials;
+	long	*lat;
+	long	n;
+
+	trials = 50;
+	if (ac > 1)
+		trials = atol(av[1]);
+	lat = safe_malloc(sizeof(long) * trials);
+	printf("mode    shards      N  latency (us)                    |"
+		"  <100  <250  <500  <1ms  <2ms  <5ms <10ms >10ms\n");
+	memset(&table, 0, sizeof(t_table));
+	table.time_to_die = 50 * MS_TO_US;
+	table.nbr_limit_meals = -1;
+	table.opts.on_event = bench_died;
+	n = 1;
+	while (n < 10000)
+	{
+		n *= 10;
+		table.philo_nbr = n;
+		table.philo_cap = n;
+		bench_modes(&table, trials, lat);
+	}
+	free(lat);
+	return (0);
+}
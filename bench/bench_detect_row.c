@@ -0,0 +1,72 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_detect_row.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/21 14:52:26 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 14:52:26 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+/* bench_detect : tri des latences d'une ligne, tranches et affichage. */
+
+/**
+ * @brief Ordre croissant des latences (qsort).
+ */
+int	detect_cmp(const void *a, const void *b)
+{
+	return ((*(long *)a > *(long *)b) - (*(long *)a < *(long *)b));
+}
+
+/**
+ * @brief Une ligne de resultats : p50, p99, max et le nombre d'essais
+ * par tranche de latence (bornes de detect_row).
+ */
+void	detect_print(t_table *table, long *lat, long trials, const long *bound)
+{
+	long	bucket[8];
+	long	i;
+	long	b;
+	char	*mode;
+
+	memset(bucket, 0, sizeof(bucket));
+	i = -1;
+	while (++i < trials)
+	{
+		b = 0;
+		while (b < 7 && lat[i] >= bound[b])
+			b++;
+		bucket[b]++;
+	}
+	mode = "scan";
+	if (table->opts.timerfd)
+		mode = "timerfd";
+	printf("%-7s %6ld %6ld  p50 %5ld  p99 %5ld  max %5ld |", mode,
+		table->opts.shards, table->philo_nbr, lat[trials / 2],
+		lat[trials * 99 / 100], lat[trials - 1]);
+	b = -1;
+	while (++b < 8)
+		printf(" %5ld", bucket[b]);
+	printf("\n");
+}
+
+/**
+ * @brief trials essais pour le N et le mode courants de la table.
+ */
+void	detect_row(t_table *table, long trials, long *lat)
+{
+	static const long	bound[7] = {100, 250, 500, 1000, 2000, 5000, 10000};
+	long				i;
+
+	data_init(table);
+	i = -1;
+	while (++i < trials)
+		lat[i] = bench_trial(table, rand() % table->philo_nbr);
+	clean(table);
+	qsort(lat, trials, sizeof(long), detect_cmp);
+	detect_print(table, lat, trials, bound);
+}
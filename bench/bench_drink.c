@@ -0,0 +1,151 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_drink.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 21:48:33 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 15:03:15 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "bench.h"
+
+/* Benchmark : debit et equite du mode buveurs (--drinking) contre le
+mode a deux fourchettes, a nombre de places egal. Chaque ligne est un
+diner de duration ms sans deces possible (time_to_die de 60 s), arrete
+par un minuteur ; time_to_eat = time_to_sleep = 10 ms, --low-cpu.
+- two-fork : mode habituel (mutex, ordre pair/impair) ;
+- drink R=1 script 3 : memes deux fourchettes, verrous a tickets ;
+- drink R=1/R=2 random : sous-ensembles tires au hasard.
+Equite : indice de Jain sur les sessions par philo (1 = parfait) ;
+max(us) : plus longue attente d'une session. Toutes les lignes passent
+par check_drinking avant le premier diner.
+Usage : ./bench/bench_drink [philos] [duration ms] */
+
+/* Rayon (0 = deux fourchettes), masque de script (0 = hasard). */
+static const long	g_rows[][2] = {{0, 0}, {1, 3}, {1, 0}, {2, 0}, {-1, 0}};
+
+/**
+ * @brief Callback muet : les statuts ne sont ni affiches ni comptes.
+ */
+void	bench_mute(void *user, long time_ms, int id, t_philo_event event)
+{
+	(void)user;
+	(void)time_ms;
+	(void)id;
+	(void)event;
+}
+
+/**
+ * @brief Minuteur : arrete le diner apres duration ms.
+ */
+void	*bench_timer(void *data)
+{
+	t_timer	*timer;
+
+	timer = (t_timer *)data;
+	wait_all_threads(timer->table);
+	sleep_until(timer->table, get_time(MICROSECOND)
+		+ timer->duration * 1000);
+	wake_all(timer->table, &timer->table->end_simulation);
+	return (NULL);
+}
+
+/**
+ * @brief Sessions, indice de Jain, extremes, attente moyenne et plus
+ * longue attente d'une session sur un diner termine (threads joints).
+ */
+void	bench_print(t_table *table, char *mode, long duration)
+{
+	t_philo	*philo;
+	long	i;
+	long	m[5];
+	double	sq;
+
+	memset(m, 0, sizeof(m));
+	m[1] = LONG_MAX;
+	sq = 0;
+	i = -1;
+	while (++i < table->philo_nbr)
+	{
+		philo = table->philos + i;
+		m[0] += philo->meals_counter;
+		sq += (double)philo->meals_counter * philo->meals_counter;
+		if (philo->meals_counter < m[1])
+			m[1] = philo->meals_counter;
+		if (philo->meals_counter > m[2])
+			m[2] = philo->meals_counter;
+		m[3] += philo->fork_wait;
+		if (philo->max_fork_wait > m[4])
+			m[4] = philo->max_fork_wait;
+	}
+	printf("%-22s %9.1f %6.3f %6ld %6ld %9.0f %9ld\n", mode, m[0] * 1000.0
+		/ duration, (double)m[0] * m[0] / (table->philo_nbr * sq + !sq),
+		m[1], m[2], (double)m[3] / (m[0] + !m[0]), m[4]);
+}
+
+/**
+ * @brief Pose le mode buveurs d'une ligne de g_rows et le verifie comme
+ * la ligne de commande (check_drinking), puis, si run, lance un diner
+ * de duration ms.
+ */
+void	bench_row(t_table *table, const long *row, long duration, bool run)
+{
+	t_timer		timer;
+	pthread_t	thread;
+	char		mode[32];
+
+	table->opts.drink_radius = row[0];
+	table->opts.drink_script[0] = row[1];
+	table->opts.drink_script_len = (row[1] != 0);
+	check_drinking(table);
+	if (!run)
+		return ;
+	snprintf(mode, sizeof(mode), "drink R=%ld random", row[0]);
+	if (row[1])
+		snprintf(mode, sizeof(mode), "drink R=%ld script %ld", row[0], row[1]);
+	if (!row[0])
+		snprintf(mode, sizeof(mode), "two-fork");
+	table->philo_cap = table->philo_nbr;
+	table->nbr_limit_meals = -1;
+	timer.table = table;
+	timer.duration = duration;
+	data_init(table);
+	safe_thread_handle(&thread, bench_timer, &timer, CREATE);
+	dinner_start(table);
+	safe_thread_handle(&thread, NULL, NULL, JOIN);
+	bench_print(table, mode, duration);
+	clean(table);
+}
+
+int	main(int ac, char **av)
+{
+	t_table	table;
+	long	duration;
+	long	i;
+
+	memset(&table, 0, sizeof(t_table));
+	table.philo_nbr = 50;
+	duration = 2000;
+	if (ac > 1)
+		table.philo_nbr = atol(av[1]);
+	if (ac > 2)
+		duration = atol(av[2]);
+	table.time_to_die = 60000 * MS_TO_US;
+	table.time_to_eat = 10 * MS_TO_US;
+	table.time_to_sleep = 10 * MS_TO_US;
+	table.opts.low_cpu = true;
+	table.opts.on_event = bench_mute;
+	i = -1;
+	while (g_rows[++i][0] >= 0)
+		bench_row(&table, g_rows[i], duration, false);
+	printf("%ld philos, %ld ms\nmode                   sessions/s   jain"
+		"    min    max  wait(us)   max(us)\n", table.philo_nbr, duration);
+	i = -1;
+	while (g_rows[++i][0] >= 0)
+		bench_row(&table, g_rows[i], duration, true);
+	return (0);
+}
@@ -0,0 +1,78 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_output.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 18:58:21 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/19 18:58:21 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+#include <fcntl.h>
+
+/* Benchmark : lignes de statut par seconde, printf contre la sortie
+rapide (--fast-output), sous write_lock comme dans write_status.
+La sortie standard est redirigee vers /dev/null pour ne mesurer que
+le formatage et les appels systeme.
+Usage : ./bench/bench_output [lignes] [philos] */
+
+/**
+ * @brief Ecrit lines statuts en tournant sur les philos et les statuts.
+ * 
+ * @return Lignes par seconde
+ */
+double	bench_lines(t_table *table, long lines)
+{
+	long	i;
+	long	start;
+	t_philo	*philo;
+
+	start = get_time(MICROSECOND);
+	i = -1;
+	while (++i < lines)
+	{
+		philo = table->philos + i % table->philo_nbr;
+		safe_handle_mutex(&table->write_lock, LOCK);
+		if (table->opts.fast_output)
+			out_status(table, philo, i % DIED, i / 8);
+		else
+			print_status(i % DIED, philo, i / 8);
+		safe_handle_mutex(&table->write_lock, UNLOCK);
+	}
+	if (table->opts.fast_output)
+		out_flush(&table->output);
+	fflush(stdout);
+	return (lines / ((get_time(MICROSECOND) - start) / 1e6));
+}
+
+int	main(int ac, char **av)
+{
+	t_table	table;
+	long	lines;
+	double	slow;
+	double	fast;
+
+	memset(&table, 0, sizeof(t_table));
+	table.philo_nbr = 1000;
+	lines = 5000000;
+	if (ac > 1)
+		lines = atol(av[1]);
+	if (ac > 2)
+		table.philo_nbr = atol(av[2]);
+	table.time_to_die = 800 * MS_TO_US;
+	table.opts.fast_output = true;
+	data_init(&table);
+	dup2(open("/dev/null", O_WRONLY), STDOUT_FILENO);
+	table.opts.fast_output = false;
+	slow = bench_lines(&table, lines);
+	table.opts.fast_output = true;
+	fast = bench_lines(&table, lines);
+	fprintf(stderr, "%ld lines, %ld philos: printf %.1f M lines/s, "
+		"fast-output %.1f M lines/s (x%.1f)\n", lines, table.philo_nbr,
+		slow / 1e6, fast / 1e6, fast / slow);
+	clean(&table);
+	return (0);
+}
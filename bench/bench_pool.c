@@ -0,0 +1,135 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_pool.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 11:48:52 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 14:58:40 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "philo.h"
+
+/* Benchmark : temps de rotation d'un scenario court, threads crees a
+chaque run (dinner_start) contre pool persistant (philo_run). Chaque run
+est arrete des le premier statut, il ne reste que le cout de demarrage
+et d'arret des philo_nbr + 1 threads. --low-cpu est actif dans les deux
+modes pour que les attentes (decalage des impairs) s'interrompent a
+l'arret au lieu de finir leur usleep.
+Usage : ./bench/bench_pool [runs] [philos] */
+
+/**
+ * @brief Callback des deux modes : arrete le run au premier statut.
+ */
+void	bench_stop(void *user, long time_ms, int id, t_philo_event event)
+{
+	t_philo_sim	*sim;
+
+	(void)time_ms;
+	(void)id;
+	(void)event;
+	sim = (t_philo_sim *)user;
+	if (sim->running)
+		philo_stop(sim);
+	else
+		wake_all(&sim->table, &sim->table.end_simulation);
+}
+
+/**
+ * @brief runs scenarios avec creation et join des threads a chaque run.
+ * 
+ * @return Microsecondes par run
+ */
+double	bench_spawn(t_philo_sim *sim, long runs)
+{
+	long	i;
+	long	start;
+
+	sim->table.philo_cap = sim->table.philo_nbr;
+	data_init(&sim->table);
+	start = get_time(MICROSECOND);
+	i = -1;
+	while (++i < runs)
+	{
+		data_reset(&sim->table);
+		dinner_start(&sim->table);
+	}
+	start = get_time(MICROSECOND) - start;
+	clean(&sim->table);
+	return ((double)start / runs);
+}
+
+/**
+ * @brief runs scenarios via libphilo, threads parques entre les runs.
+ * 
+ * @return Microsecondes par run
+ */
+double	bench_pooled(t_philo_config *config, long runs)
+{
+	t_philo_sim	*sim;
+	long		i;
+	long		start;
+
+	if (philo_create(&sim) != PHILO_OK)
+		error("bench_pool : philo_create failed\n");
+	config->user = sim;
+	philo_configure(sim, config);
+	start = get_time(MICROSECOND);
+	i = -1;
+	while (++i < runs)
+		if (philo_run(sim, NULL) != PHILO_OK)
+			error("bench_pool : philo_run failed\n");
+	start = get_time(MICROSECOND) - start;
+	philo_destroy(sim);
+	return ((double)start / runs);
+}
+
+/**
+ * @brief Lit les arguments (runs, philos) et prepare la configuration
+ * libphilo et la table du mode spawn avec les memes valeurs.
+ * 
+ * @return Le nombre de runs
+ */
+long	bench_setup(t_philo_sim *sim, t_philo_config *config, int ac,
+	char **av)
+{
+	long	runs;
+
+	memset(sim, 0, sizeof(t_philo_sim));
+	*config = (t_philo_config){50, 800, 200, 200, -1, true, bench_stop,
+		NULL};
+	runs = 1000;
+	if (ac > 1)
+		runs = atol(av[1]);
+	if (ac > 2)
+		config->philo_nbr = atol(av[2]);
+	sim->config = *config;
+	sim->table.philo_nbr = config->philo_nbr;
+	sim->table.time_to_die = config->time_to_die * MS_TO_US;
+	sim->table.time_to_eat = config->time_to_eat * MS_TO_US;
+	sim->table.time_to_sleep = config->time_to_sleep * MS_TO_US;
+	sim->table.nbr_limit_meals = -1;
+	sim->table.opts.low_cpu = true;
+	sim->table.opts.on_event = bench_stop;
+	sim->table.opts.user = sim;
+	return (runs);
+}
+
+int	main(int ac, char **av)
+{
+	t_philo_sim		sim;
+	t_philo_config	config;
+	long			runs;
+	double			spawn;
+	double			pooled;
+
+	runs = bench_setup(&sim, &config, ac, av);
+	spawn = bench_spawn(&sim, runs);
+	pooled = bench_pooled(&config, runs);
+	printf("%ld runs, %ld philos: spawn %.0f us/run, pool %.0f us/run "
+		"(x%.1f)\n", runs, config.philo_nbr, spawn, pooled, spawn / pooled);
+	return (0);
+}
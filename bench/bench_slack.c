@@ -0,0 +1,125 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_slack.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 18:02:11 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 14:36:02 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "philo.h"
+
+/* Benchmark : plus petit time_to_die qui survit a un diner de meals repas
+par philo, avec et sans --slack-priority, pour un nombre impair de philos
+(le cas ou une fourchette est toujours disputee). Recherche dichotomique
+au pas de 5 ms entre 3 * time_to_eat et 4 * time_to_eat ; chaque valeur
+doit survivre a trials diners de suite. --low-cpu et statuts absorbes
+par un callback vide, pour que seul l'ordonnancement compte.
+Usage : ./bench/bench_slack [philos] [meals] [trials] */
+
+/**
+ * @brief Callback muet : les statuts ne sont ni affiches ni comptes.
+ */
+void	bench_mute(void *user, long time_ms, int id, t_philo_event event)
+{
+	(void)user;
+	(void)time_ms;
+	(void)id;
+	(void)event;
+}
+
+/**
+ * @brief Un diner complet avec ttd ms pour mourir.
+ * 
+ * @return Vrai si personne n'est mort
+ */
+bool	bench_dinner(t_table *table, long ttd)
+{
+	bool	survived;
+
+	table->time_to_die = ttd * MS_TO_US;
+	table->philo_cap = table->philo_nbr;
+	data_init(table);
+	dinner_start(table);
+	survived = (table->dead_id == 0);
+	clean(table);
+	return (survived);
+}
+
+/**
+ * @brief Dichotomie sur time_to_die, le mode priority donne : une valeur
+ * est retenue si elle survit a trials diners de suite.
+ * 
+ * @return Plus petit time_to_die (ms) qui survit, au pas de 5 ms
+ */
+long	bench_tightest(t_table *table, bool priority, long trials)
+{
+	long	lo;
+	long	hi;
+	long	mid;
+	long	left;
+
+	table->opts.slack_priority = priority;
+	lo = 3 * table->time_to_eat / MS_TO_US;
+	hi = 4 * table->time_to_eat / MS_TO_US;
+	while (hi - lo > 5)
+	{
+		mid = (lo + hi) / 2;
+		left = trials;
+		while (left > 0 && bench_dinner(table, mid))
+			left--;
+		if (left == 0)
+			hi = mid;
+		else
+			lo = mid;
+	}
+	return (hi);
+}
+
+/**
+ * @brief Lit les arguments (philos, repas, essais) et prepare la table :
+ * 100 ms pour manger et dormir, --low-cpu, statuts muets.
+ * 
+ * @return Le nombre d'essais par valeur de time_to_die
+ */
+long	bench_args(t_table *table, int ac, char **av)
+{
+	long	trials;
+
+	memset(table, 0, sizeof(t_table));
+	table->philo_nbr = 201;
+	table->nbr_limit_meals = 5;
+	trials = 3;
+	if (ac > 1)
+		table->philo_nbr = atol(av[1]);
+	if (ac > 2)
+		table->nbr_limit_meals = atol(av[2]);
+	if (ac > 3)
+		trials = atol(av[3]);
+	table->time_to_eat = 100 * MS_TO_US;
+	table->time_to_sleep = 100 * MS_TO_US;
+	table->opts.low_cpu = true;
+	table->opts.on_event = bench_mute;
+	return (trials);
+}
+
+int	main(int ac, char **av)
+{
+	t_table	table;
+	long	trials;
+	long	plain;
+	long	priority;
+
+	trials = bench_args(&table, ac, av);
+	plain = bench_tightest(&table, false, trials);
+	priority = bench_tightest(&table, true, trials);
+	printf("%ld philos, %ld meals: tightest time_to_die %ld ms plain, "
+		"%ld ms with --slack-priority (theory %ld ms)\n", table.philo_nbr,
+		table.nbr_limit_meals, plain, priority,
+		(long)(3 * table.time_to_eat / MS_TO_US));
+	return (0);
+}
@@ -0,0 +1,143 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_snapshot.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:02:16 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 15:06:47 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+/* Benchmark : debit de snapshot_take a grand N pendant que des threads
+ecrivains publient des changements d'etat au rythme d'une vraie
+simulation (events_per_sec par philo, ~15/s pour 800 200 200).
+Usage : ./bench/bench_snapshot [N] [ecrivains] [secondes] [events/s] */
+
+/**
+ * @brief Thread ecrivain : fait tourner les statuts de ses philos.
+ * Chaque philo n'a qu'un ecrivain, comme dans la simulation.
+ */
+void	*writer_routine(void *data)
+{
+	t_writer	*w;
+	long		i;
+	long		round;
+	long		start;
+
+	w = data;
+	round = 0;
+	start = get_time(MICROSECOND);
+	while (!atomic_load_explicit(w->stop, memory_order_relaxed))
+	{
+		i = w->from - 1;
+		while (++i < w->to)
+		{
+			w->table->philos[i].meals_counter = round;
+			w->table->philos[i].last_meal_time = get_time(MILLISECOND);
+			snapshot_publish(w->table->philos + i, round % 5);
+		}
+		round++;
+		if (round * 1e6 / w->rate > get_time(MICROSECOND) - start)
+			usleep(round * 1e6 / w->rate - (get_time(MICROSECOND) - start));
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Prepare une table de N philos sans lancer la simulation.
+ */
+void	bench_table(t_table *table, long n)
+{
+	memset(table, 0, sizeof(t_table));
+	table->philo_nbr = n;
+	table->time_to_die = 800 * MS_TO_US;
+	table->time_to_eat = 200 * MS_TO_US;
+	table->time_to_sleep = 200 * MS_TO_US;
+	table->nbr_limit_meals = -1;
+	data_init(table);
+}
+
+/**
+ * @brief Prend des snapshots en boucle pendant secs secondes.
+ */
+void	bench_reader(t_table *table, long secs)
+{
+	t_snapshot	snap;
+	long		ok;
+	long		total;
+	long		attempts;
+	long		start;
+
+	snapshot_alloc(table, &snap);
+	ok = 0;
+	total = 0;
+	attempts = 0;
+	start = get_time(MICROSECOND);
+	while (get_time(MICROSECOND) - start < secs * 1e6)
+	{
+		ok += snapshot_take(table, &snap);
+		attempts += snap.attempts;
+		total++;
+	}
+	printf("N=%-8ld %10.1f snap/s  %7.2f ns/philo  %6.2f passes/snap"
+		"  %ld/%ld ok\n", table->philo_nbr, total / (double)secs,
+		(get_time(MICROSECOND) - start) * 1e3
+		/ ((double)attempts * table->philo_nbr), attempts / (double)total,
+		ok, total);
+	snapshot_free(&snap);
+}
+
+/**
+ * @brief Lance les ecrivains, mesure le lecteur, puis nettoie.
+ */
+void	bench_run(long n, long writers, long secs, long rate)
+{
+	t_table		table;
+	t_writer	*w;
+	pthread_t	*th;
+	atomic_bool	stop;
+	long		i;
+
+	bench_table(&table, n);
+	w = safe_malloc(sizeof(t_writer) * writers);
+	th = safe_malloc(sizeof(pthread_t) * writers);
+	stop = false;
+	i = -1;
+	while (++i < writers)
+	{
+		w[i] = (t_writer){&table, n * i / writers, n * (i + 1) / writers,
+			rate, &stop};
+		safe_thread_handle(th + i, writer_routine, w + i, CREATE);
+	}
+	bench_reader(&table, secs);
+	atomic_store(&stop, true);
+	i = -1;
+	while (++i < writers)
+		safe_thread_handle(th + i, NULL, NULL, JOIN);
+	free(w);
+	free(th);
+	clean(&table);
+}
+
+int	main(int ac, char **av)
+{
+	long	n;
+
+	if (ac > 4)
+		bench_run(atol(av[1]), atol(av[2]), atol(av[3]), atol(av[4]));
+	else if (ac > 1)
+		bench_run(atol(av[1]), 4, 2, 15);
+	if (ac > 1)
+		return (0);
+	n = 1000;
+	while (n <= 1000000)
+	{
+		bench_run(n, 4, 2, 15);
+		n *= 10;
+	}
+	return (0);
+}
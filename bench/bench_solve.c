@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_solve.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 16:41:09 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/19 16:41:09 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/* Verification du solveur (--solve) sur un corpus aleatoire : chaque
+scenario decide est rejoue par le moteur DES (un worker), qui doit donner
+la meme issue. Les scenarios indecis sont seulement comptes.
+Usage : ./bench/bench_solve [scenarios] [graine] */
+
+/**
+ * @brief Tire un scenario : 1 a 200 philos, temps de 60 a 999 ms,
+ * nombre_de_repas absent une fois sur deux.
+ */
+void	bench_scenario(t_table *table)
+{
+	memset(table, 0, sizeof(t_table));
+	table->philo_nbr = 1 + rand() % 200;
+	table->time_to_die = (60 + rand() % 940) * MS_TO_US;
+	table->time_to_eat = (60 + rand() % 400) * MS_TO_US;
+	table->time_to_sleep = (60 + rand() % 400) * MS_TO_US;
+	table->nbr_limit_meals = -1;
+	if (rand() % 2)
+		table->nbr_limit_meals = 1 + rand() % 10;
+}
+
+/**
+ * @brief Simule le scenario avec le moteur DES sur 20 periodes.
+ * 
+ * @return L'instant du deces (ms), DES_INF si personne ne meurt
+ */
+long	bench_simulate(t_table *table)
+{
+	t_des	des;
+	long	death_at;
+
+	if (table->philo_nbr == 1)
+		return (table->time_to_die / 1000 + 1);
+	des_init(&des, table, 1, 20 * (solve_needed(table)
+			+ table->time_to_die / 1000));
+	des_run(&des);
+	death_at = des.death_at;
+	des_destroy(&des);
+	return (death_at);
+}
+
+/**
+ * @brief Compare le verdict du solveur au resultat simule.
+ * 
+ * @param count Compteurs par verdict, puis erreurs en count[3]
+ */
+void	bench_check(t_table *table, long count[4])
+{
+	t_verdict	verdict;
+	long		expected;
+	long		death_at;
+
+	verdict = solve(table, &expected);
+	count[verdict]++;
+	if (verdict == UNDECIDED)
+		return ;
+	death_at = bench_simulate(table);
+	if ((verdict == SURVIVES && death_at == DES_INF)
+		|| (verdict == DIES && death_at == expected))
+		return ;
+	count[3]++;
+	printf("mismatch: ./philo %ld %ld %ld %ld %ld : solver %d, des %ld\n",
+		table->philo_nbr, table->time_to_die / 1000,
+		table->time_to_eat / 1000, table->time_to_sleep / 1000,
+		table->nbr_limit_meals, verdict, death_at);
+}
+
+int	main(int ac, char **av)
+{
+	t_table	table;
+	long	count[4];
+	long	total;
+	long	i;
+	long	start;
+
+	total = 10000;
+	if (ac > 1)
+		total = atol(av[1]);
+	srand(42);
+	if (ac > 2)
+		srand(atoi(av[2]));
+	memset(count, 0, sizeof(count));
+	start = get_time(MICROSECOND);
+	i = -1;
+	while (++i < total)
+	{
+		bench_scenario(&table);
+		bench_check(&table, count);
+	}
+	printf("%ld scenarios in %.1f s: %ld survive, %ld die, %ld undecided, "
+		"%ld mismatches\n", total, (get_time(MICROSECOND) - start) / 1e6,
+		count[SURVIVES], count[DIES], count[UNDECIDED], count[3]);
+	return (count[3] != 0);
+}
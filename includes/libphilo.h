@@ -0,0 +1,84 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   libphilo.h                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 09:12:40 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 14:15:03 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef LIBPHILO_H
+# define LIBPHILO_H
+
+# include <stdbool.h>
+# define PHILO_API __attribute__((visibility("default")))
+
+/* API publique de libphilo : une simulation = un handle opaque,
+reutilisable pour plusieurs runs. Aucune fonction ne fait exit : les
+erreurs sont rendues sous forme de t_philo_err. */
+
+typedef struct s_philo_sim	t_philo_sim;
+
+/* Codes de retour */
+typedef enum e_philo_err
+{
+	PHILO_OK,
+	PHILO_EINVAL,
+	PHILO_ENOMEM,
+	PHILO_ETHREAD,
+	PHILO_ESTATE,
+}	t_philo_err;
+
+/* Evenements passes au callback (meme ordre que t_philo_status) */
+typedef enum e_philo_event
+{
+	PHILO_EATING,
+	PHILO_SLEEPING,
+	PHILO_THINKING,
+	PHILO_TAKE_FIRST_FORK,
+	PHILO_TAKE_SECOND_FORK,
+	PHILO_DIED,
+}	t_philo_event;
+
+/* Appele sous le verrou d'ecriture, a la place de l'affichage */
+typedef void				(*t_philo_cb)(void *user, long time_ms, int id,
+								t_philo_event event);
+
+/* Parametres d'un run (temps en ms, nbr_limit_meals = -1 sans limite) */
+typedef struct s_philo_config
+{
+	long		philo_nbr;
+	long		time_to_die;
+	long		time_to_eat;
+	long		time_to_sleep;
+	long		nbr_limit_meals;
+	bool		low_cpu;
+	t_philo_cb	on_event;
+	void		*user;
+}	t_philo_config;
+
+/* Issue d'un run */
+typedef struct s_philo_result
+{
+	int		dead_id;
+	long	dead_at;
+	long	duration;
+	long	meals_min;
+	long	meals_total;
+	bool	stopped;
+}	t_philo_result;
+
+/* Seules ces fonctions sont exportees par libphilo.so : le reste est
+compile en -fvisibility=hidden (voir le Makefile). */
+PHILO_API t_philo_err	philo_create(t_philo_sim **sim);
+PHILO_API t_philo_err	philo_configure(t_philo_sim *sim,
+							const t_philo_config *config);
+PHILO_API t_philo_err	philo_run(t_philo_sim *sim, t_philo_result *result);
+PHILO_API t_philo_err	philo_stop(t_philo_sim *sim);
+PHILO_API void			philo_destroy(t_philo_sim *sim);
+PHILO_API const char	*philo_strerror(t_philo_err err);
+
+#endif
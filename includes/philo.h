@@ -6,7 +6,7 @@
 /*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/22 17:58:59 by marguima          #+#    #+#             */
-/*   Updated: 2026/01/25 15:06:55 by marguima         ###   ########.fr       */
+/*   Updated: 2026/10/21 14:44:51 by marguima         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -17,24 +17,79 @@
 # include <unistd.h> 
 # include <pthread.h>
 # include <sys/time.h>
+# include <sys/resource.h>
+# include <sys/uio.h>
 # include <limits.h>
 # include <stdbool.h>
 # include <errno.h>
 # include <stdint.h>
+# include <stdatomic.h>
+# include <string.h>
+# include "libphilo.h"
 
 typedef pthread_mutex_t	t_mutex;
+typedef pthread_cond_t	t_cond;
 typedef struct s_table	t_table;
+typedef struct s_des	t_des;
+typedef struct s_pool	t_pool;
+typedef struct s_shards	t_shards;
+typedef atomic_uint		t_seq;
 # define MS_TO_US 1e3
+# define METRICS_MAGIC 0x5048494c
+# define METRICS_DEFAULT "/philo_metrics"
+# define HOLD_FIRST 1
+# define HOLD_SECOND 2
+# define SNAP_RETRIES 64
+# define DES_INF LONG_MAX
+# define DES_ROUNDS 3
+# define DES_CHUNK_MIN 64
+# define DES_CHUNKS_PER_WORKER 4
+# define SOLVE_MARGIN 10
+# define OUT_CHUNK 65536
+# define OUT_CHUNKS 16
+# define OUT_SUFFIX 32
+# define OUT_LINE_MAX 64
+# define OUT_MAP_SIZE 67108864
+# define OUT_FLUSH_MS 50
+# define TRACE_MAGIC "PHTR1"
+# define TRACE_BUF 1048576
+# define DEADLINE_EVENTS 256
+# define SLACK_BUCKETS 256
+# define MONITOR_SPIN_US 1000
+# define DRINK_MAX 16
+# define DRINK_SCRIPT_MAX 32
+
+/* USDT : sondes statiques du fournisseur "philo" (perf, bpftrace,
+tools/bpftrace/). Avec <sys/sdt.h> (systemtap-sdt-dev), une sonde
+inactive est un simple nop ; sans, elles disparaissent a la compilation
+sans evaluer leurs arguments. */
+# if defined(__has_include)
+#  if __has_include(<sys/sdt.h>)
+#   include <sys/sdt.h>
+#   define PHILO_USDT 1
+#  endif
+# endif
+# ifdef PHILO_USDT
+#  define PROBE0(name) DTRACE_PROBE(philo, name)
+#  define PROBE1(name, a) DTRACE_PROBE1(philo, name, a)
+#  define PROBE2(name, a, b) DTRACE_PROBE2(philo, name, a, b)
+#  define PROBE3(name, a, b, c) DTRACE_PROBE3(philo, name, a, b, c)
+# else
+#  define PROBE0(name) ((void)0)
+#  define PROBE1(name, a) ((void)0)
+#  define PROBE2(name, a, b) ((void)0)
+#  define PROBE3(name, a, b, c) ((void)0)
+# endif
 
 /* ETATS PHILOS */
 typedef enum e_status
 {
-	EATING,
-	SLEEPING,
-	THINKING,
-	TAKE_FIRST_FORK,
-	TAKE_SECOND_FORK,
-	DIED,
+	EATING = PHILO_EATING,
+	SLEEPING = PHILO_SLEEPING,
+	THINKING = PHILO_THINKING,
+	TAKE_FIRST_FORK = PHILO_TAKE_FIRST_FORK,
+	TAKE_SECOND_FORK = PHILO_TAKE_SECOND_FORK,
+	DIED = PHILO_DIED,
 }			t_philo_status;
 
 /* CODES POUR GET TIME*/
@@ -57,13 +112,336 @@ typedef enum e_fcode
 	DETACH,
 }	t_fcode;
 
+/* OPTIONS (--nom[=valeur] apres les arguments) */
+typedef struct s_options
+{
+	char	*metrics_name;
+	long	max_philos;
+	long	elastic_period;
+	long	des_horizon;
+	long	des_threads;
+	bool	des_check;
+	bool	solve;
+	bool	low_cpu;
+	bool	cpu_report;
+	bool	fast_output;
+	char	*output_file;
+	char	*trace_file;
+	bool	timerfd;
+	bool	slack_report;
+	bool	slack_priority;
+	long	shards;
+	long	drink_radius; // --drinking : 2R bouteilles par place, 0 = off
+	long	drink_script[DRINK_SCRIPT_MAX]; // Masques de --drink-script
+	long	drink_script_len;
+	t_philo_cb	on_event;
+	void	*user;
+}	t_options;
+
+typedef struct s_option
+{
+	char	*name;
+	void	(*apply)(t_table *, char *);
+}	t_option;
+
+/* METRICS : une ligne par philo, ecrite sous seqlock par son thread */
+typedef struct s_metrics_slot
+{
+	_Alignas(64) t_seq	seq;
+	int					id;
+	atomic_int			state;
+	atomic_long			meals;
+	atomic_long			last_meal;
+	atomic_long			fork_wait;
+}	t_metrics_slot;
+
+/* METRICS : page POSIX shm lue par philo-top */
+typedef struct s_metrics
+{
+	atomic_uint		magic;
+	atomic_long		philo_nbr;
+	long			time_to_die;
+	long			time_to_eat;
+	long			time_to_sleep;
+	atomic_long		start_simulation;
+	atomic_int		running;
+	atomic_int		dead_id;
+	t_metrics_slot	slots[];
+}	t_metrics;
+
+/* SNAPSHOT : une version de l'etat public d'un philo, datee par epoch */
+typedef struct s_view
+{
+	atomic_long	epoch;
+	atomic_long	seq; // Rang de la version chez ce philo (meme epoch)
+	atomic_int	state;
+	atomic_int	forks;
+	atomic_int	first_fork;
+	atomic_int	second_fork;
+	atomic_long	meals;
+	atomic_long	last_meal;
+}	t_view;
+
+/* SNAPSHOT : copie privee d'un philo, coherente avec le reste de la table */
+typedef struct s_philo_snap
+{
+	int				id;
+	t_philo_status	state;
+	int				forks;
+	int				first_fork;
+	int				second_fork;
+	long			meals;
+	long			last_meal;
+}	t_philo_snap;
+
+/* SNAPSHOT : photo de toute la table a l'epoch donnee */
+typedef struct s_snapshot
+{
+	long			epoch;
+	long			taken_at;
+	long			philo_nbr;
+	long			attempts;
+	t_philo_snap	*philos;
+}	t_snapshot;
+
+/* ELASTIC : controleur des arrivees/departs en fin d'anneau */
+typedef struct s_elastic
+{
+	pthread_t	thread;
+	long		base;
+	long		joins;
+	long		leaves;
+	long		join_us;
+	long		join_max;
+	long		leave_us;
+	long		leave_max;
+}	t_elastic;
+
+/* OUTPUT : sortie rapide (--fast-output, --output=FICHIER). suffix contient
+" <id> <action>\n" pour chaque philo et chaque statut, deja formate */
+typedef struct s_output
+{
+	char			*suffix;
+	unsigned char	*suffix_len;
+	char			*buf;
+	struct iovec	iov[OUT_CHUNKS];
+	int				chunk;
+	int				fd;
+	char			*map;
+	size_t			map_base;
+	size_t			map_pos;
+	long			flushed_at; // Dernier passage de out_tick (ms)
+}	t_output;
+
+/* TRACE : evenements binaires (--trace=FICHIER). Apres l'entete
+TRACE_MAGIC + varints (places, die, eat, sleep en ms), chaque evenement
+vaut varint((delta_ms << 3) | statut) puis varint(id) */
+typedef struct s_trace
+{
+	int				fd;
+	unsigned char	*buf;
+	size_t			len;
+	long			last;
+}	t_trace;
+
+/* TRACE : evenement decode par philo-trace */
+typedef struct s_trace_event
+{
+	long	time;
+	long	id;
+	int		status;
+}	t_trace_event;
+
+/* TRACE : lecture d'un fichier --trace (philo-trace) */
+typedef struct s_trace_reader
+{
+	unsigned char	*buf;
+	size_t			size;
+	size_t			pos;
+	long			time;
+	long			cap;
+	long			die;
+	long			eat;
+	long			sleep;
+}	t_trace_reader;
+
+/* TRACE : analyse hors ligne. Accumulateurs {somme, nombre, max} */
+typedef struct s_trace_stats
+{
+	long	*last_meal;
+	long	*take1;
+	long	*take2;
+	long	events;
+	long	gap[3];
+	long	gap_worst;
+	long	hold1[3];
+	long	hold2[3];
+	long	wait2[3];
+	long	end_time;
+	long	death_id;
+}	t_trace_stats;
+
+/* CPU : precision des sommeils et de la detection (--cpu-report) */
+typedef struct s_cpu
+{
+	atomic_long	late_sum; // Retard cumule des precise_usleep (us)
+	atomic_long	late_count;
+	atomic_long	late_max;
+	atomic_long	death_lag; // Detection du deces apres l'echeance (ms)
+}	t_cpu;
+
+/* DEADLINE : une echeance timerfd par place, attendue via epoll
+(--timerfd) */
+typedef struct s_deadline
+{
+	int		epfd;
+	int		*fds; // philo_cap timerfd, epoll data = index de la place
+	long	count; // timerfd crees : fds[0] a fds[count - 1]
+}	t_deadline;
+
+/* SHARDS : une tranche de places contigues et son thread (--shards) */
+typedef struct s_shard
+{
+	pthread_t	thread;
+	t_shards	*group;
+	long		index;
+}	t_shard;
+
+struct s_shards
+{
+	t_table	*table;
+	t_shard	*slots;
+	long	count;
+	long	dead; // Place du premier deces signale + 1, 0 si aucun
+	t_mutex	lock;
+	t_cond	posted; // Signale par une tranche qui a vu un deces
+};
+
+/* SOLVE : issue prevue sans simulation */
+typedef enum e_verdict
+{
+	SURVIVES,
+	DIES,
+	UNDECIDED,
+}	t_verdict;
+
+/* DES : etats d'un philo en temps virtuel (ms) */
+typedef enum e_des_phase
+{
+	DES_THINK,
+	DES_HUNGRY,
+	DES_HOLD1,
+	DES_EAT,
+	DES_SLEEP,
+	DES_DONE,
+}	t_des_phase;
+
+/* DES : etapes d'une fenetre, separees par une barriere */
+typedef enum e_des_step
+{
+	DES_PREPARE,
+	DES_FORKS,
+	DES_APPLY,
+}	t_des_step;
+
+/* DES : philo virtuel. req1/req2/rel/meal_at ne valent que pour la
+fenetre courante */
+typedef struct s_des_philo
+{
+	int		phase;
+	int		first;
+	int		second;
+	long	until;
+	long	since;
+	long	last_meal;
+	long	meals;
+	long	req1;
+	long	req2;
+	long	rel;
+	long	meal_at;
+}	t_des_philo;
+
+/* DES : fourchette virtuelle. resolved = tour ou son sort est fixe */
+typedef struct s_des_fork
+{
+	atomic_int	resolved;
+	int			holder;
+	int			grant_to;
+	long		grant_at;
+}	t_des_fork;
+
+/* DES : barriere mutex + cond (pas de pthread_barrier sur macOS) */
+typedef struct s_des_barrier
+{
+	t_mutex			mutex;
+	pthread_cond_t	cond;
+	int				count;
+	int				waiting;
+	long			generation;
+}	t_des_barrier;
+
+/* DES : un worker = un segment de l'anneau, vole le travail des autres */
+typedef struct s_des_worker
+{
+	_Alignas(64) atomic_ulong	range;
+	t_des						*des;
+	int							idx;
+	long						death_at;
+	long						death_pos;
+	long						done;
+	long						done_at;
+	long						stolen;
+	pthread_t					thread;
+}	t_des_worker;
+
+/* DES : moteur a evenements discrets en temps virtuel */
+struct s_des
+{
+	long			n;
+	long			die;
+	long			eat;
+	long			sleep;
+	long			think;
+	long			limit;
+	long			lookahead;
+	long			horizon;
+	long			now;
+	long			windows;
+	int				workers;
+	long			chunk;
+	long			nchunks;
+	bool			finished;
+	long			death_at;
+	long			death_pos;
+	long			end_at;
+	t_des_philo		*philos;
+	t_des_fork		*forks;
+	t_des_worker	*w;
+	t_des_barrier	barrier;
+};
+
 /* FORKS */
 typedef struct s_fork
 {
-	t_mutex	fork;
-	int		fork_id;
+	t_mutex		fork;
+	int			fork_id;
+	atomic_long	urgent; // Echeance (ms) du voisin prioritaire, 0 si aucun
+	atomic_long	next_ticket; // --drinking : verrou a tickets (FIFO)
+	atomic_long	serving;
+	t_cond		served; // --drinking : diffuse a chaque ticket servi
 }	t_fork;
 
+/* SLACK : marge avant la mort au debut de chaque repas d'un philo */
+typedef struct s_slack
+{
+	long	min; // Plus petite marge vue (ms)
+	long	count; // Repas mesures
+	double	sx; // Moindres carres (x = repas, y = marge), hors 1er repas
+	double	sy;
+	double	sxy;
+	double	sxx;
+}	t_slack;
+
 /* PHILOS */
 typedef struct s_philo
 {
@@ -71,17 +449,33 @@ typedef struct s_philo
 	long		meals_counter;
 	bool		full;
 	long		last_meal_time;
+	long		fork_wait; // Attente cumulee des fourchettes (us)
+	long		max_meal_gap; // Plus long ecart entre deux repas (ms)
+	long		max_fork_wait; // Plus longue attente d'une prise (us)
+	t_slack		slack; // --slack, ecrit par le philo seul
+	bool		leaving; // Demande de depart (--elastic)
+	bool		churn_neighbour; // Voisin d'une arrivee/d'un depart
 	t_fork		*first_fork; // left
 	t_fork		*second_fork; // right
+	t_fork		*bottles[DRINK_MAX]; // --drinking : session en cours
+	int			bottle_nbr;
+	long		tickets[DRINK_MAX]; // Ticket tire sur chaque bouteille
+	unsigned int	drink_seed; // rand_r des sessions --drinking
 	pthread_t	thread_id;
 	t_mutex		philo_mutex;
+	t_mutex		seat_lock; // Tenu pendant eat() : fourchettes stables
+	t_seq		view_seq; // Seqlock des deux versions de view
+	t_view		view[2];
+	int			view_cur; // Version la plus recente (ecrivain seul)
+	long		view_count; // Versions publiees (ecrivain seul)
 	t_table		*table;
 }	t_philo;
 
 /* TABLE */
 struct s_table
 {
-	long		philo_nbr;
+	long		philo_nbr; // Taille courante de l'anneau (table_mutex)
+	long		philo_cap; // Taille des tableaux philos/forks
 	long		time_to_die;
 	long		time_to_eat;
 	long		time_to_sleep;
@@ -92,21 +486,90 @@ struct s_table
 	long		threads_running_nb;
 	pthread_t	monitor;
 	t_mutex		table_mutex;
+	t_cond		table_cond; // Reveille les attentes de --low-cpu
+	t_cond		slack_cond; // --slack-priority : une urgence est levee
 	t_mutex		write_lock;
+	t_mutex		drink_lock; // --drinking : tickets d'une session d'un coup
 	t_fork		*forks;
 	t_philo		*philos;
+	t_options	opts;
+	t_metrics	*metrics;
+	size_t		metrics_size;
+	atomic_long	snap_epoch; // Horloge logique des snapshots
+	t_snapshot	scan; // Snapshot du monitor, philo_cap copies
+	atomic_long	ring_size; // philo_nbr pour les lecteurs sans verrou
+	t_elastic	elastic;
+	t_cpu		cpu;
+	t_output	output;
+	t_trace		trace;
+	t_deadline	deadline;
+	atomic_long	slack_hist[SLACK_BUCKETS]; // Marges de tous les repas
+	long		slack_width; // Largeur d'une tranche (ms)
+	int			dead_id; // Premier mort (0 si aucun)
+	long		dead_at; // Instant du deces (ms depuis le depart)
+};
+
+/* POOL : un thread parque par place, reveille a chaque run */
+typedef struct s_pool_slot
+{
+	pthread_t	thread;
+	t_pool		*pool;
+	long		index; // 0 = monitor, i = philos[i - 1]
+	long		seen; // Derniere generation vue
+}	t_pool_slot;
+
+struct s_pool
+{
+	t_pool_slot	**slots; // Pointeurs stables : un slot par thread
+	long		size;
+	long		active; // Slots qui travaillent dans ce run
+	long		generation; // +1 a chaque run : libere le pool
+	long		done; // Slots actifs revenus au parking
+	bool		quit;
+	t_table		*table;
+	t_mutex		lock;
+	t_cond		start; // Slots actifs
+	t_cond		idle; // Slots au-dela de active
+	t_cond		finished;
+};
+
+/* LIBPHILO : handle opaque de l'API publique (libphilo.h) */
+struct s_philo_sim
+{
+	t_table			table;
+	t_pool			pool;
+	t_philo_config	config;
+	bool			configured;
+	bool			running; // Sous table_mutex, pour philo_stop
+	bool			stopped; // philo_stop appele pendant le run
+	atomic_bool		busy; // Un seul philo_run a la fois
 };
 
 /* MAIN FUNCTIONS */
 void	parse_input(t_table *table, char **av);
+void	observers_init(t_table *table);
+void	philo_reset(t_table *table);
+bool	data_alloc(t_table *table);
+void	data_reset(t_table *table);
+void	data_free(t_table *table);
 void	data_init(t_table *table);
 void	dinner_start(t_table *table);
+void	*dinner_simulation(void *data);
+void	*alone_philo(void *arg);
+void	eat(t_philo *philo);
 void	clean(t_table *table);
+bool	table_locks_init(t_table *table);
+void	table_locks_destroy(t_table *table);
+bool	seat_lock_init(t_table *table, long i);
+bool	seat_locks_init(t_table *table);
+void	seat_locks_destroy(t_table *table, long n);
 
 /* SAFE FUNCTIONS */
 void	*safe_malloc(size_t bytes);
 void	handle_mutex_error(int status, t_fcode fcode);
 void	*safe_handle_mutex(t_mutex *mutex, t_fcode fcode);
+void	handle_cond_error(int status, t_fcode fcode);
+void	*safe_handle_cond(t_cond *cond, t_fcode fcode);
 void	handle_thread_error(int status, t_fcode fcode);
 void	safe_thread_handle(pthread_t *thread, void *(*foo)(void *),
 			void *arg, t_fcode fcode);
@@ -129,10 +592,165 @@ void	wait_all_threads(t_table *table);
 bool	all_threads_running(t_mutex *mutex, long *threads, long philo_nb);
 void	increase_long(t_mutex *mutex, long *value);
 
+/* INIT */
+void	assign_fork(t_philo *philo, t_fork *forks, int philo_pos, long ring);
+void	philo_seat(t_table *table, t_philo *philo, int pos);
+
+/* ELASTIC */
+void	*elastic_routine(void *data);
+void	ring_resize(t_table *table, long n);
+bool	elastic_all_full(t_table *table);
+void	elastic_record(long *count, long *sum, long *max, long us);
+void	elastic_report(t_table *table);
+void	elastic_rest(t_philo *philo, long usec);
+
+/* DES */
+void	des_init(t_des *des, t_table *table, int workers, long horizon);
+void	des_destroy(t_des *des);
+void	des_run(t_des *des);
+void	des_prepare(t_des *des, long p);
+long	des_request(t_des *des, long x, long f, int round);
+void	des_resolve_fork(t_des *des, long f, int round);
+void	des_apply(t_des_worker *w, long p);
+void	des_reduce(t_des *des);
+void	barrier_wait(t_des_barrier *barrier);
+unsigned long	des_checksum(t_des *des);
+void	des_main(t_table *table);
+
+/* SOLVE */
+long	solve_needed(t_table *table);
+t_verdict	solve(t_table *table, long *death_at);
+bool	solve_main(t_table *table);
+
 /* MONITOR */
 void	*monitor(void *data);
+bool	monitor_suspect(t_table *table, t_philo_snap *p, long now);
+void	monitor_report(t_table *table, t_philo *philo);
+bool	philo_died(t_philo *philo);
+
+/* DRINKING */
+long	drink_mask(t_philo *philo);
+void	drink_sort(t_philo *philo);
+void	drink_pick(t_philo *philo);
+void	drink_reset(t_table *table);
+void	drink_lock(t_philo *philo, int i);
+void	drink_take(t_philo *philo);
+void	drink_release(t_philo *philo);
+void	check_drink_script(t_table *table);
+void	check_drinking(t_table *table);
+
+/* SHARDS */
+void	shard_post(t_shards *group, long seat);
+bool	shard_pass(t_shard *shard, long lo, long hi, long *deadline);
+void	*shard_scan(void *data);
+void	shard_coordinate(t_table *table);
+void	shard_start(t_table *table, t_shards *group);
+void	shard_timedwait(t_shards *group, long us);
+
+/* OUTPUT */
+void	print_status(t_philo_status status, t_philo *philo, long elapsed);
+void	emit_status(t_table *table, t_philo *philo, t_philo_status status,
+			long elapsed);
+int		out_utoa(char *dst, long n);
+char	*out_reserve(t_output *out);
+void	out_status(t_table *table, t_philo *philo, t_philo_status status,
+			long elapsed);
+void	out_flush(t_output *out);
+void	out_tick(t_table *table);
+void	out_writev(int fd, struct iovec *iov, int count);
+void	out_init(t_table *table);
+void	out_map(t_output *out);
+void	out_destroy(t_table *table);
+
+/* TRACE */
+void	trace_init(t_table *table);
+size_t	trace_varint(unsigned char *dst, unsigned long value);
+void	trace_event(t_table *table, t_philo *philo, t_philo_status status,
+			long elapsed);
+void	trace_flush(t_trace *trace);
+void	trace_destroy(t_table *table);
+bool	trace_next(t_trace_reader *r, t_trace_event *ev);
+void	trace_stats(t_trace_reader *r);
+
+/* LIBPHILO */
+t_philo_err	lib_check(const t_philo_config *config);
+t_philo_err	lib_prepare(t_philo_sim *sim);
+void	lib_result(t_philo_sim *sim, t_philo_result *result);
+
+/* POOL */
+t_philo_err	pool_init(t_pool *pool, t_table *table);
+t_philo_err	pool_grow(t_pool *pool, long size);
+void	pool_run(t_pool *pool, t_table *table);
+void	pool_destroy(t_pool *pool);
+
+/* SLACK */
+void	slack_record(t_philo *philo, long now);
+void	slack_yield(t_philo *philo);
+void	slack_clear(t_philo *philo);
+void	slack_init(t_table *table);
+void	slack_report(t_table *table);
+
+/* DEADLINE */
+bool	deadline_init(t_table *table);
+void	deadline_arm(t_philo *philo);
+void	deadline_watch(t_table *table);
+void	deadline_destroy(t_table *table);
+
+/* LOW CPU */
+void	wake_all(t_table *table, bool *flag);
+void	wait_flag(t_table *table, bool *flag);
+void	sleep_until(t_table *table, long deadline);
+long	snap_deadline(t_table *table, t_philo_snap *p);
+long	next_death(t_table *table, t_snapshot *snap);
+void	cpu_record_sleep(t_table *table, long late);
+void	cpu_report(t_table *table);
 
 /* PARSING UTILS */
 long	ft_atol(char *nptr);
+void	check_options(t_table *table);
+int		parse_options(t_table *table, int ac, char **av);
+void	opt_metrics(t_table *table, char *val);
+void	opt_max_philos(t_table *table, char *val);
+void	opt_elastic(t_table *table, char *val);
+void	opt_des(t_table *table, char *val);
+void	opt_des_threads(t_table *table, char *val);
+void	opt_des_check(t_table *table, char *val);
+void	opt_solve(t_table *table, char *val);
+void	opt_low_cpu(t_table *table, char *val);
+void	opt_cpu_report(t_table *table, char *val);
+void	opt_fast_output(t_table *table, char *val);
+void	opt_output(t_table *table, char *val);
+void	opt_trace(t_table *table, char *val);
+void	check_output(t_table *table);
+void	opt_timerfd(t_table *table, char *val);
+void	opt_slack(t_table *table, char *val);
+void	opt_slack_priority(t_table *table, char *val);
+void	opt_shards(t_table *table, char *val);
+void	opt_drinking(t_table *table, char *val);
+void	opt_drink_script(t_table *table, char *val);
+
+/* SEQLOCK */
+void	seq_write_begin(t_seq *seq);
+void	seq_write_end(t_seq *seq);
+unsigned int	seq_read_begin(t_seq *seq);
+bool	seq_read_retry(t_seq *seq, unsigned int start);
+
+/* SNAPSHOT */
+void	view_write(t_philo *philo, t_philo_status state, int forks);
+void	snapshot_publish(t_philo *philo, t_philo_status status);
+void	snapshot_release_forks(t_philo *philo);
+bool	snapshot_read_philo(t_philo *philo, long epoch, t_philo_snap *out);
+bool	snapshot_take(t_table *table, t_snapshot *snap);
+void	snapshot_alloc(t_table *table, t_snapshot *snap);
+void	snapshot_free(t_snapshot *snap);
+int		snapshot_fork_holder(t_snapshot *snap, int fork_id);
+long	snapshot_min_slack(t_table *table, t_snapshot *snap);
+
+/* METRICS */
+void	metrics_init(t_table *table);
+void	metrics_start(t_table *table);
+void	metrics_publish(t_philo *philo, t_philo_status status);
+void	metrics_stop(t_table *table, t_philo *dead);
+void	metrics_destroy(t_table *table);
 
 #endif
\ No newline at end of file
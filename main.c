@@ -6,7 +6,7 @@
 /*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/17 23:20:42 by marguima          #+#    #+#             */
-/*   Updated: 2026/01/27 08:40:08 by marguima         ###   ########.fr       */
+/*   Updated: 2026/10/19 16:52:30 by marguima         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,14 +16,22 @@ int	main(int ac, char **av)
 {
 	t_table	table;
 
+	ac = parse_options(&table, ac, av);
 	if (ac == 5 || ac == 6)
 	{
 		parse_input(&table, av);
-		data_init(&table);
-		dinner_start(&table);
-		clean(&table);
+		if (table.opts.solve && solve_main(&table))
+			return (0);
+		if (table.opts.des_horizon > 0)
+			des_main(&table);
+		else
+		{
+			data_init(&table);
+			dinner_start(&table);
+			clean(&table);
+		}
 	}
 	else
 		error("Wrong input: ./philo [Nb philo][Time to die]"
-			"[Time to eat][Time to sleep]\n");
+			"[Time to eat][Time to sleep] [--metrics[=name]]\n");
 }
@@ -0,0 +1,81 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cpu_report.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 17:26:14 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 10:31:18 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/**
+ * @brief Note le retard d'un precise_usleep (--cpu-report).
+ * 
+ * @param table Structure principale
+ * @param late Duree dormie en trop (us)
+ */
+void	cpu_record_sleep(t_table *table, long late)
+{
+	long	max;
+
+	if (late < 0)
+		return ;
+	atomic_fetch_add_explicit(&table->cpu.late_sum, late,
+		memory_order_relaxed);
+	atomic_fetch_add_explicit(&table->cpu.late_count, 1, memory_order_relaxed);
+	max = atomic_load_explicit(&table->cpu.late_max, memory_order_relaxed);
+	while (late > max && !atomic_compare_exchange_weak(&table->cpu.late_max,
+			&max, late))
+		;
+}
+
+/**
+ * @brief Temps CPU (utilisateur + systeme) consomme par le processus.
+ * 
+ * @return Secondes CPU
+ */
+double	cpu_seconds(void)
+{
+	struct rusage	usage;
+
+	getrusage(RUSAGE_SELF, &usage);
+	return (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec
+		+ (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6);
+}
+
+/**
+ * @brief --cpu-report : temps CPU consomme par seconde simulee, et ce
+ * qu'il coute en precision (retard des sommeils, detection du deces).
+ * Affiche sur stderr pour ne pas melanger avec les statuts.
+ * 
+ * @param table Structure principale
+ */
+void	cpu_report(t_table *table)
+{
+	double	cpu;
+	double	wall;
+	long	count;
+	char	*mode;
+
+	cpu = cpu_seconds();
+	wall = (get_time(MILLISECOND) - table->start_simulation) / 1e3;
+	count = atomic_load(&table->cpu.late_count);
+	mode = "spin";
+	if (table->opts.low_cpu)
+		mode = "low-cpu";
+	fprintf(stderr, "cpu: %.2f s CPU for %.2f s simulated "
+		"(%.3f CPU s per simulated s, %s)\n", cpu, wall, cpu / wall, mode);
+	if (count == 0)
+		count = 1;
+	fprintf(stderr, "cpu: sleeps late by avg %ld us, max %ld us "
+		"(%ld sleeps)\n", atomic_load(&table->cpu.late_sum) / count,
+		atomic_load(&table->cpu.late_max),
+		atomic_load(&table->cpu.late_count));
+	if (atomic_load(&table->cpu.death_lag) >= 0)
+		fprintf(stderr, "cpu: death detected %ld ms after its deadline\n",
+			atomic_load(&table->cpu.death_lag));
+}
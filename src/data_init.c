@@ -0,0 +1,111 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   data_init.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 09:31:55 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 11:02:14 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/* Cycle de vie de la table : data_alloc une fois (tableaux et mutex),
+data_reset avant chaque run, data_free a la fin. Le programme enchaine
+les trois via data_init et clean ; libphilo garde les allocations d'un
+run a l'autre tant que philo_nbr tient dans philo_cap. */
+
+/**
+ * @brief Alloue les tableaux de philosophes et de forks a philo_cap
+ * places (--max-philos) et initialise leurs mutex, le verrou des
+ * tickets --drinking et les echeances --timerfd. Ils ne sont jamais
+ * realloues pendant un run : les pointeurs first_fork/second_fork
+ * restent valides pendant les arrivees/departs.
+ * 
+ * @param table 
+ * @return false si une allocation, un mutex ou un timerfd echoue (rien
+ * ne reste alloue)
+ */
+bool	data_alloc(t_table *table)
+{
+	table->philos = malloc(sizeof(t_philo) * table->philo_cap);
+	table->forks = malloc(sizeof(t_fork) * table->philo_cap);
+	table->scan.philos = malloc(sizeof(t_philo_snap) * table->philo_cap);
+	if (!table->philos || !table->forks || !table->scan.philos
+		|| !seat_locks_init(table))
+	{
+		free(table->philos);
+		free(table->forks);
+		free(table->scan.philos);
+		table->philos = NULL;
+		table->forks = NULL;
+		table->scan.philos = NULL;
+		return (false);
+	}
+	if (deadline_init(table))
+		return (true);
+	data_free(table);
+	return (false);
+}
+
+/**
+ * @brief Remet la table dans l'etat de depart d'un run : drapeaux,
+ * compteurs, places et observateurs.
+ * 
+ * @param table 
+ */
+void	data_reset(t_table *table)
+{
+	table->end_simulation = false;
+	table->all_ready = false;
+	table->threads_running_nb = 0;
+	table->dead_id = 0;
+	table->dead_at = 0;
+	atomic_init(&table->snap_epoch, 0);
+	atomic_init(&table->ring_size, table->philo_nbr);
+	philo_reset(table);
+	drink_reset(table);
+	observers_init(table);
+}
+
+/**
+ * @brief Detruit les mutex et les echeances des places et libere les
+ * tableaux (rien si data_alloc n'a pas eu lieu).
+ * 
+ * @param table 
+ */
+void	data_free(t_table *table)
+{
+	if (table->philos)
+	{
+		seat_locks_destroy(table, table->philo_cap);
+		safe_handle_mutex(&table->drink_lock, DESTROY);
+	}
+	deadline_destroy(table);
+	free(table->forks);
+	free(table->philos);
+	free(table->scan.philos);
+	table->scan.philos = NULL;
+	table->forks = NULL;
+	table->philos = NULL;
+}
+
+/**
+ * @brief Initialise la table pour un run du programme : mutex de la
+ * table, tableaux, puis etat de depart.
+ * 
+ * @param table 
+ */
+void	data_init(t_table *table)
+{
+	if (table->philo_cap < table->philo_nbr)
+		table->philo_cap = table->philo_nbr;
+	if (!table_locks_init(table))
+		error("Philosopher : Mutex init error\n");
+	if (!data_alloc(table))
+		error("Philosopher : Table setup error (memory, or --timerfd: "
+			"Linux only, open file limit)\n");
+	data_reset(table);
+}
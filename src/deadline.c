@@ -0,0 +1,124 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   deadline.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 13:20:05 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 11:02:14 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "philo.h"
+#ifdef __linux__
+# include <sys/epoll.h>
+# include <sys/resource.h>
+# include <sys/timerfd.h>
+
+/* Detection des deces par echeances (--timerfd) : chaque place a un
+timerfd arme en absolu sur last_meal_time + time_to_die + 1 ms, rearme a
+chaque repas. Le monitor dort dans epoll_wait et ne verifie que les
+places dont l'echeance est passee : la latence ne depend plus de
+philo_nbr, contrairement au scan complet. */
+
+/**
+ * @brief Cree le timerfd de la place seat et l'ajoute a l'epoll.
+ * 
+ * @param dl Echeances de la table
+ * @param seat Index de la place
+ * @return false si timerfd_create ou epoll_ctl echoue (limite de
+ * descripteurs atteinte le plus souvent)
+ */
+bool	deadline_seat(t_deadline *dl, long seat)
+{
+	struct epoll_event	ev;
+
+	dl->fds[seat] = timerfd_create(CLOCK_REALTIME, TFD_NONBLOCK
+			| TFD_CLOEXEC);
+	ev.events = EPOLLIN;
+	ev.data.u64 = seat;
+	if (dl->fds[seat] < 0)
+		return (false);
+	if (epoll_ctl(dl->epfd, EPOLL_CTL_ADD, dl->fds[seat], &ev) == 0)
+		return (true);
+	close(dl->fds[seat]);
+	return (false);
+}
+
+/**
+ * @brief Cree un timerfd par place (philo_cap) et les enregistre dans
+ * l'epoll. Releve la limite de descripteurs si besoin. Rien a faire
+ * sans --timerfd.
+ * 
+ * @param table Structure principale
+ * @return false si un descripteur ou l'allocation echoue (tout est
+ * referme)
+ */
+bool	deadline_init(t_table *table)
+{
+	t_deadline		*dl;
+	struct rlimit	lim;
+
+	dl = &table->deadline;
+	dl->epfd = -1;
+	dl->fds = NULL;
+	dl->count = 0;
+	if (!table->opts.timerfd)
+		return (true);
+	if (!getrlimit(RLIMIT_NOFILE, &lim)
+		&& lim.rlim_cur < (rlim_t)table->philo_cap + 64)
+	{
+		lim.rlim_cur = lim.rlim_max;
+		setrlimit(RLIMIT_NOFILE, &lim);
+	}
+	dl->epfd = epoll_create1(EPOLL_CLOEXEC);
+	dl->fds = malloc(sizeof(int) * table->philo_cap);
+	while (dl->epfd >= 0 && dl->fds && dl->count < table->philo_cap
+		&& deadline_seat(dl, dl->count))
+		dl->count++;
+	if (dl->count == table->philo_cap)
+		return (true);
+	deadline_destroy(table);
+	return (false);
+}
+
+/**
+ * @brief Arme l'echeance du philo sur son dernier repas. Appele par le
+ * thread du philo juste apres chaque mise a jour de last_meal_time.
+ * 
+ * @param philo Philosophe qui vient de manger (ou de s'asseoir)
+ */
+void	deadline_arm(t_philo *philo)
+{
+	struct itimerspec	spec;
+	long				at;
+
+	if (!philo->table->opts.timerfd)
+		return ;
+	at = philo->last_meal_time + philo->table->time_to_die / MS_TO_US + 1;
+	memset(&spec, 0, sizeof(spec));
+	spec.it_value.tv_sec = at / 1000;
+	spec.it_value.tv_nsec = (at % 1000) * 1000000;
+	timerfd_settime(philo->table->deadline.fds[philo - philo->table->philos],
+		TFD_TIMER_ABSTIME, &spec, NULL);
+}
+
+/**
+ * @brief Ferme les timerfd crees et l'epoll.
+ * 
+ * @param table Structure principale
+ */
+void	deadline_destroy(t_table *table)
+{
+	while (table->deadline.count > 0)
+		close(table->deadline.fds[--table->deadline.count]);
+	if (table->deadline.epfd >= 0)
+		close(table->deadline.epfd);
+	free(table->deadline.fds);
+	table->deadline.fds = NULL;
+	table->deadline.epfd = -1;
+}
+
+#endif
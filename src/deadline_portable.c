@@ -0,0 +1,43 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   deadline_portable.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 13:34:51 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 11:02:14 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "philo.h"
+#ifndef __linux__
+
+/* timerfd et epoll n'existent que sous Linux : ailleurs --timerfd est
+refuse (deadline_init echoue) et les autres appels ne font rien. */
+
+bool	deadline_init(t_table *table)
+{
+	table->deadline.epfd = -1;
+	table->deadline.fds = NULL;
+	table->deadline.count = 0;
+	return (!table->opts.timerfd);
+}
+
+void	deadline_arm(t_philo *philo)
+{
+	(void)philo;
+}
+
+void	deadline_watch(t_table *table)
+{
+	(void)table;
+}
+
+void	deadline_destroy(t_table *table)
+{
+	(void)table;
+}
+
+#endif
@@ -0,0 +1,60 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   deadline_watch.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 13:29:40 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 10:44:51 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "philo.h"
+#ifdef __linux__
+# include <sys/epoll.h>
+
+/**
+ * @brief Vide le timerfd d'une place qui a sonne et verifie le philo.
+ * Une echeance perimee (le philo a mange entre-temps) est ignoree :
+ * philo_died relit last_meal_time et le timer a deja ete rearme.
+ * 
+ * @param table Structure principale
+ * @param seat Index de la place
+ */
+void	deadline_check(t_table *table, long seat)
+{
+	uint64_t	expirations;
+
+	if (read(table->deadline.fds[seat], &expirations, sizeof(uint64_t)) < 0)
+		return ;
+	if (seat < get_long(&table->table_mutex, &table->philo_nbr)
+		&& philo_died(table->philos + seat))
+		monitor_report(table, table->philos + seat);
+}
+
+/**
+ * @brief Boucle du monitor avec --timerfd. Le delai de 1 ms d'epoll_wait
+ * ne sert qu'a voir passer end_simulation quand tous sont rassasies
+ * et a vider la sortie rapide (out_tick).
+ * 
+ * @param table Structure principale
+ */
+void	deadline_watch(t_table *table)
+{
+	struct epoll_event	events[DEADLINE_EVENTS];
+	int					count;
+	int					i;
+
+	while (!simulation_finished(table))
+	{
+		count = epoll_wait(table->deadline.epfd, events, DEADLINE_EVENTS, 1);
+		i = -1;
+		while (++i < count && !simulation_finished(table))
+			deadline_check(table, events[i].data.u64);
+		out_tick(table);
+	}
+}
+
+#endif
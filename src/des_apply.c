@@ -0,0 +1,121 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   des_apply.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:24:03 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 14:02:10 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/**
+ * @brief Transitions a heure fixe dans la fenetre : fin de repas, fin de
+ * sieste, fin de reflexion.
+ */
+void	des_advance(t_des *des, t_des_philo *x)
+{
+	long	end;
+
+	end = des->now + des->lookahead;
+	if (x->phase == DES_EAT && x->until < end)
+	{
+		x->phase = DES_SLEEP;
+		x->since = x->until;
+		x->until += des->sleep;
+		if (des->limit > 0 && x->meals >= des->limit)
+			x->phase = DES_DONE;
+	}
+	if (x->phase == DES_SLEEP && x->until < end)
+	{
+		x->phase = DES_THINK;
+		x->until += des->think;
+	}
+	if (x->phase == DES_THINK && x->until < end)
+	{
+		x->phase = DES_HUNGRY;
+		x->since = x->until;
+	}
+}
+
+/**
+ * @brief Le philo p recoit les fourchettes qui lui ont ete attribuees
+ * dans la fenetre ; un repas commence avec la seconde.
+ */
+void	des_grab(t_des *des, t_des_philo *x, long p)
+{
+	t_des_fork	*fork;
+
+	fork = des->forks + x->first;
+	if (x->phase == DES_HUNGRY && fork->grant_to == p)
+	{
+		x->phase = DES_HOLD1;
+		x->since = fork->grant_at;
+	}
+	fork = des->forks + x->second;
+	if (x->phase == DES_HOLD1 && fork->grant_to == p)
+	{
+		x->phase = DES_EAT;
+		x->meal_at = fork->grant_at;
+		x->last_meal = fork->grant_at;
+		x->until = fork->grant_at + des->eat;
+		x->meals++;
+	}
+}
+
+/**
+ * @brief Garde dans le worker la mort la plus precoce de la fenetre (a
+ * instant egal, la plus petite position).
+ * 
+ * @param w Worker qui traite p
+ * @param death Instant de mort du philo p si rien ne change
+ * @param p Position du philo
+ */
+void	des_note_death(t_des_worker *w, long death, long p)
+{
+	if (death >= w->des->now + w->des->lookahead)
+		return ;
+	if (death < w->death_at || (death == w->death_at && p < w->death_pos))
+	{
+		w->death_at = death;
+		w->death_pos = p;
+	}
+}
+
+/**
+ * @brief Etape 3 : applique la fenetre au philo p et note dans le worker
+ * la premiere mort et les philos rassasies.
+ * 
+ * Un philo meurt a last_meal + time_to_die + 1 si aucun repas ne commence
+ * avant. Un philo rassasie (DES_DONE) ne meurt plus.
+ * 
+ * @param w Worker qui traite p
+ * @param p Position du philo
+ */
+void	des_apply(t_des_worker *w, long p)
+{
+	t_des		*des;
+	t_des_philo	*x;
+	long		death;
+
+	des = w->des;
+	x = des->philos + p;
+	if (!atomic_load_explicit(&des->forks[p].resolved, memory_order_relaxed))
+		error("DES : fourchette non resolue.\n");
+	death = x->last_meal + des->die + 1;
+	des_advance(des, x);
+	des_grab(des, x, p);
+	if (x->meal_at >= 0 && x->meal_at < death)
+		death = x->meal_at + des->die + 1;
+	if (x->phase == DES_DONE && x->since < death)
+	{
+		w->done++;
+		if (x->since > w->done_at)
+			w->done_at = x->since;
+		return ;
+	}
+	des_note_death(w, death, p);
+}
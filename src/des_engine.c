@@ -0,0 +1,149 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   des_engine.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:31:12 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 14:02:10 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/**
+ * @brief Prend le prochain segment : d'abord au debut de son propre
+ * intervalle [lo, hi[, sinon vole la fin de celui d'un autre worker.
+ * 
+ * range contient lo << 32 | hi, modifie par CAS.
+ * 
+ * @param w Worker courant
+ * @return Index du segment, -1 s'il n'y a plus rien a faire
+ */
+long	des_pop(t_des_worker *w)
+{
+	t_des_worker	*v;
+	unsigned long	r;
+	int				k;
+
+	k = -1;
+	while (++k < w->des->workers)
+	{
+		v = w->des->w + (w->idx + k) % w->des->workers;
+		r = atomic_load(&v->range);
+		while ((r >> 32) < (r & 0xffffffffUL))
+		{
+			if (k == 0 && atomic_compare_exchange_weak(&v->range, &r,
+					r + (1UL << 32)))
+				return (r >> 32);
+			if (k > 0 && atomic_compare_exchange_weak(&v->range, &r, r - 1))
+			{
+				w->stolen++;
+				return ((r & 0xffffffffUL) - 1);
+			}
+		}
+	}
+	return (-1);
+}
+
+/**
+ * @brief Traite les philos (ou fourchettes) d'un segment pour une etape.
+ */
+void	des_chunk(t_des_worker *w, t_des_step step, int round, long c)
+{
+	long	i;
+	long	end;
+
+	i = c * w->des->chunk;
+	end = i + w->des->chunk;
+	if (end > w->des->n)
+		end = w->des->n;
+	while (i < end)
+	{
+		if (step == DES_PREPARE)
+			des_prepare(w->des, i);
+		else if (step == DES_FORKS)
+			des_resolve_fork(w->des, i, round);
+		else
+			des_apply(w, i);
+		i++;
+	}
+}
+
+/**
+ * @brief Execute une etape de la fenetre sur tous les segments qu'il
+ * obtient, puis attend les autres workers.
+ * 
+ * @param w Worker courant
+ * @param step Etape (DES_PREPARE, DES_FORKS ou DES_APPLY)
+ * @param round Tour de resolution des fourchettes (DES_FORKS)
+ */
+void	des_phase(t_des_worker *w, t_des_step step, int round)
+{
+	t_des	*des;
+	long	chunk;
+
+	des = w->des;
+	atomic_store(&w->range, (unsigned long)(des->nchunks * w->idx
+			/ des->workers) << 32 | des->nchunks * (w->idx + 1) / des->workers);
+	chunk = des_pop(w);
+	while (chunk >= 0)
+	{
+		des_chunk(w, step, round, chunk);
+		chunk = des_pop(w);
+	}
+	barrier_wait(&des->barrier);
+}
+
+/**
+ * @brief Routine d'un worker : une fenetre par tour de boucle, le
+ * worker 0 fait la reduction entre deux barrieres.
+ * 
+ * @param data Worker (t_des_worker *)
+ */
+void	*des_worker(void *data)
+{
+	t_des_worker	*w;
+	int				round;
+
+	w = (t_des_worker *)data;
+	while (!w->des->finished)
+	{
+		des_phase(w, DES_PREPARE, 0);
+		round = 0;
+		while (++round <= DES_ROUNDS)
+			des_phase(w, DES_FORKS, round);
+		w->death_at = DES_INF;
+		w->death_pos = -1;
+		w->done = 0;
+		w->done_at = 0;
+		des_phase(w, DES_APPLY, 0);
+		if (w->idx == 0)
+			des_reduce(w->des);
+		barrier_wait(&w->des->barrier);
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Lance les workers et attend la fin de la simulation.
+ * 
+ * @param des Moteur initialise par des_init
+ */
+void	des_run(t_des *des)
+{
+	int	i;
+
+	i = -1;
+	while (++i < des->workers)
+	{
+		memset(des->w + i, 0, sizeof(t_des_worker));
+		des->w[i].des = des;
+		des->w[i].idx = i;
+		safe_thread_handle(&des->w[i].thread, des_worker, des->w + i, CREATE);
+	}
+	i = -1;
+	while (++i < des->workers)
+		safe_thread_handle(&des->w[i].thread, NULL, NULL, JOIN);
+}
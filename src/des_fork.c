@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   des_fork.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/21 14:02:10 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 14:02:10 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/**
+ * @brief Choisit qui obtient la fourchette : premier demandeur (FIFO),
+ * puis celui qui a mange le moins recemment, puis la plus petite position.
+ * 
+ * @return 0 ou 1 (index dans who/t), -1 si personne ne la demande
+ */
+int	des_winner(t_des *des, long who[2], long t[2])
+{
+	if (t[0] == DES_INF && t[1] == DES_INF)
+		return (-1);
+	if (t[0] != t[1])
+		return (t[1] < t[0]);
+	if (des->philos[who[0]].last_meal != des->philos[who[1]].last_meal)
+		return (des->philos[who[1]].last_meal
+			< des->philos[who[0]].last_meal);
+	return (who[1] < who[0]);
+}
+
+/**
+ * @brief Donne la fourchette au gagnant si elle lui parvient avant la
+ * fin de la fenetre, sinon la laisse libre.
+ */
+void	des_grant(t_des *des, t_des_fork *fork, long who, long at)
+{
+	fork->holder = -1;
+	if (who < 0 || at >= des->now + des->lookahead)
+		return ;
+	fork->grant_to = who;
+	fork->grant_at = at;
+	fork->holder = who;
+}
+
+/**
+ * @brief Instant ou la fourchette se libere dans la fenetre : des now si
+ * personne ne la tient, a la fin du repas de son detenteur sinon
+ * (DES_INF s'il mange encore a la fin de la fenetre).
+ */
+long	des_free_at(t_des *des, t_des_fork *fork)
+{
+	if (fork->holder < 0)
+		return (des->now);
+	return (des->philos[fork->holder].rel);
+}
+
+/**
+ * @brief Etape 2 (tour round) : fixe le sort de la fourchette f dans la
+ * fenetre si celui de ses dependances est deja connu.
+ * 
+ * La fourchette f est partagee par les positions f - 1 et f.
+ * 
+ * @param des Moteur
+ * @param f Index de la fourchette
+ * @param round Tour courant (1 a DES_ROUNDS)
+ */
+void	des_resolve_fork(t_des *des, long f, int round)
+{
+	t_des_fork	*fork;
+	long		free_at;
+	long		who[2];
+	long		t[2];
+	int			k;
+
+	fork = des->forks + f;
+	if (atomic_load_explicit(&fork->resolved, memory_order_relaxed))
+		return ;
+	free_at = des_free_at(des, fork);
+	who[0] = (f + des->n - 1) % des->n;
+	who[1] = f;
+	t[0] = des_request(des, who[0], f, round);
+	t[1] = des_request(des, who[1], f, round);
+	if (free_at != DES_INF && (t[0] < 0 || t[1] < 0))
+		return ;
+	k = des_winner(des, who, t);
+	if (free_at != DES_INF && k < 0)
+		des_grant(des, fork, -1, 0);
+	else if (free_at != DES_INF && t[k] > free_at)
+		des_grant(des, fork, who[k], t[k]);
+	else if (free_at != DES_INF)
+		des_grant(des, fork, who[k], free_at);
+	atomic_store_explicit(&fork->resolved, round, memory_order_relaxed);
+}
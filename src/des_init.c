@@ -0,0 +1,142 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   des_init.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:02:47 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 14:02:10 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/**
+ * @brief Place le philo p et sa fourchette de droite a l'instant 0, avec
+ * le meme ordre de prise que assign_fork et le meme decalage initial que
+ * dinner_simulation (les ids impairs reflechissent time_to_eat / 2).
+ * 
+ * @param des Moteur
+ * @param p Position du philo
+ */
+void	des_seat(t_des *des, long p)
+{
+	t_des_philo	*x;
+
+	x = des->philos + p;
+	memset(x, 0, sizeof(t_des_philo));
+	atomic_init(&des->forks[p].resolved, 0);
+	des->forks[p].holder = -1;
+	des->forks[p].grant_to = -1;
+	x->second = p;
+	x->first = (p + 1) % des->n;
+	if ((p + 1) % 2 == 0)
+	{
+		x->first = p;
+		x->second = (p + 1) % des->n;
+	}
+	x->phase = DES_HUNGRY;
+	if ((p + 1) % 2)
+	{
+		x->phase = DES_THINK;
+		x->until = des->eat / 2;
+	}
+}
+
+/**
+ * @brief Coupe l'anneau en segments : DES_CHUNKS_PER_WORKER segments par
+ * worker pour que le vol de travail ait de quoi equilibrer, mais jamais
+ * moins de DES_CHUNK_MIN philos (cout d'un pop). Un worker sans segment
+ * ne sert a rien : il y a au plus un worker par segment.
+ * 
+ * @param des Moteur (n deja fixe)
+ * @param workers Nombre de threads demandes
+ */
+void	des_split(t_des *des, int workers)
+{
+	des->chunk = des->n / ((long)workers * DES_CHUNKS_PER_WORKER);
+	if (des->chunk < DES_CHUNK_MIN)
+		des->chunk = DES_CHUNK_MIN;
+	des->nchunks = (des->n + des->chunk - 1) / des->chunk;
+	des->workers = workers;
+	if (des->workers > des->nchunks)
+		des->workers = des->nchunks;
+}
+
+/**
+ * @brief Initialise le moteur a partir des arguments (en ms).
+ * 
+ * La fenetre vaut min(time_to_eat, time_to_sleep) ; l'anneau est coupe
+ * en segments repartis entre les workers (des_split).
+ * 
+ * @param des Moteur a initialiser
+ * @param table Arguments lus par parse_input
+ * @param workers Nombre de threads
+ * @param horizon Duree maximale simulee (ms)
+ */
+void	des_init(t_des *des, t_table *table, int workers, long horizon)
+{
+	long	p;
+
+	memset(des, 0, sizeof(t_des));
+	des->n = table->philo_nbr;
+	des->die = table->time_to_die / 1e3;
+	des->eat = table->time_to_eat / 1e3;
+	des->sleep = table->time_to_sleep / 1e3;
+	if (des->n % 2)
+		des->think = des->eat / 2;
+	des->limit = table->nbr_limit_meals;
+	des->lookahead = des->eat;
+	if (des->sleep < des->lookahead)
+		des->lookahead = des->sleep;
+	des->horizon = horizon;
+	des_split(des, workers);
+	des->death_at = DES_INF;
+	des->philos = safe_malloc(sizeof(t_des_philo) * des->n);
+	des->forks = safe_malloc(sizeof(t_des_fork) * des->n);
+	des->w = safe_malloc(sizeof(t_des_worker) * des->workers);
+	p = -1;
+	while (++p < des->n)
+		des_seat(des, p);
+	safe_handle_mutex(&des->barrier.mutex, INIT);
+	safe_handle_cond(&des->barrier.cond, INIT);
+	des->barrier.count = des->workers;
+}
+
+/**
+ * @brief Libere les tableaux et la barriere du moteur.
+ * 
+ * @param des Moteur
+ */
+void	des_destroy(t_des *des)
+{
+	safe_handle_mutex(&des->barrier.mutex, DESTROY);
+	safe_handle_cond(&des->barrier.cond, DESTROY);
+	free(des->philos);
+	free(des->forks);
+	free(des->w);
+}
+
+/**
+ * @brief Attend que tous les workers aient atteint la barriere.
+ * 
+ * @param barrier Barriere du moteur
+ */
+void	barrier_wait(t_des_barrier *barrier)
+{
+	long	generation;
+
+	safe_handle_mutex(&barrier->mutex, LOCK);
+	generation = barrier->generation;
+	if (++barrier->waiting == barrier->count)
+	{
+		barrier->waiting = 0;
+		barrier->generation++;
+		pthread_cond_broadcast(&barrier->cond);
+	}
+	else
+		while (generation == barrier->generation)
+			pthread_cond_wait(&barrier->cond, &barrier->mutex);
+	safe_handle_mutex(&barrier->mutex, UNLOCK);
+}
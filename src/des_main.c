@@ -0,0 +1,136 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   des_main.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:40:55 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 14:02:10 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/**
+ * @brief Repas minimum, maximum et total sur l'anneau.
+ * 
+ * @param des Moteur apres des_run
+ * @param m min, max et total, en sortie
+ */
+void	des_meals(t_des *des, long m[3])
+{
+	long	p;
+
+	m[0] = LONG_MAX;
+	m[1] = 0;
+	m[2] = 0;
+	p = -1;
+	while (++p < des->n)
+	{
+		m[2] += des->philos[p].meals;
+		if (des->philos[p].meals < m[0])
+			m[0] = des->philos[p].meals;
+		if (des->philos[p].meals > m[1])
+			m[1] = des->philos[p].meals;
+	}
+}
+
+/**
+ * @brief Affiche le resultat du moteur : le deces comme le ferait
+ * write_status, ou la fin de la simulation, puis les repas et le debit.
+ * 
+ * @param des Moteur apres des_run
+ * @param us Duree reelle de des_run (us)
+ */
+void	des_print(t_des *des, long us)
+{
+	long	m[3];
+
+	des_meals(des, m);
+	if (des->death_at != DES_INF)
+		printf("%-6ld %ld died\n", des->death_at, des->death_pos + 1);
+	else
+		printf("%-6ld no death\n", des->end_at);
+	printf("des: %ld philos, meals min %ld max %ld total %ld\n",
+		des->n, m[0], m[1], m[2]);
+	printf("des: %ld windows of %ld ms, %d workers, %ld ms wall, "
+		"%.1f M philo-windows/s\n", des->windows, des->lookahead,
+		des->workers, us / 1000, des->n * des->windows / (us + 1.0));
+}
+
+/**
+ * @brief --des-check : rejoue la simulation avec un seul worker et
+ * compare l'etat final a celui de l'execution parallele.
+ * 
+ * @param table Arguments
+ * @param des Moteur apres l'execution parallele
+ */
+void	des_verify(t_table *table, t_des *des)
+{
+	t_des	ref;
+	bool	same;
+
+	des_init(&ref, table, 1, des->horizon);
+	des_run(&ref);
+	same = (ref.death_at == des->death_at && ref.death_pos == des->death_pos
+			&& ref.end_at == des->end_at
+			&& des_checksum(&ref) == des_checksum(des));
+	if (same)
+		printf("des-check: %d workers == 1 worker\n", des->workers);
+	else
+		printf("des-check: MISMATCH (%d workers != 1 worker)\n",
+			des->workers);
+	des_destroy(&ref);
+	if (!same)
+		exit(EXIT_FAILURE);
+}
+
+/**
+ * @brief --des=HORIZON : simule le diner en temps virtuel jusqu'au
+ * premier deces, a la fin des repas ou a HORIZON ms, sans dormir.
+ * 
+ * Un philo seul meurt a time_to_die + 1, comme alone_philo.
+ * 
+ * @param table Arguments lus par parse_input
+ */
+void	des_main(t_table *table)
+{
+	t_des	des;
+	long	start;
+
+	if (table->philo_nbr == 1)
+	{
+		printf("%-6ld 1 died\n", table->time_to_die / 1000 + 1);
+		return ;
+	}
+	des_init(&des, table, table->opts.des_threads, table->opts.des_horizon);
+	start = get_time(MICROSECOND);
+	des_run(&des);
+	des_print(&des, get_time(MICROSECOND) - start);
+	if (table->opts.des_check)
+		des_verify(table, &des);
+	des_destroy(&des);
+}
+
+/**
+ * @brief Empreinte de l'etat final (repas et dernier repas de chaque
+ * philo), pour comparer deux executions (--des-check).
+ * 
+ * @param des Moteur apres des_run
+ * @return L'empreinte
+ */
+unsigned long	des_checksum(t_des *des)
+{
+	unsigned long	sum;
+	long			p;
+
+	sum = des->death_at * 31 + des->death_pos;
+	p = -1;
+	while (++p < des->n)
+	{
+		sum = sum * 1099511628211UL ^ (unsigned long)des->philos[p].meals;
+		sum = sum * 1099511628211UL ^ (unsigned long)des->philos[p].last_meal;
+	}
+	return (sum);
+}
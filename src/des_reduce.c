@@ -0,0 +1,63 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   des_reduce.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/21 14:02:10 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 14:02:10 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/**
+ * @brief Retire les repas commences a la mort ou apres : la simulation
+ * s'arrete au premier deces.
+ */
+void	des_discount(t_des *des)
+{
+	long	i;
+
+	des->end_at = des->death_at;
+	i = -1;
+	while (++i < des->n)
+		if (des->philos[i].meal_at >= des->death_at)
+			des->philos[i].meals--;
+}
+
+/**
+ * @brief Etape 4 (un seul thread) : combine les workers, decide de la
+ * fin de la simulation et avance l'horloge d'une fenetre.
+ * 
+ * @param des Moteur
+ */
+void	des_reduce(t_des *des)
+{
+	t_des_worker	*w;
+	long			done;
+
+	done = 0;
+	w = des->w - 1;
+	while (++w < des->w + des->workers)
+	{
+		done += w->done;
+		if (w->done_at > des->end_at)
+			des->end_at = w->done_at;
+		if (w->death_at < des->death_at || (w->death_at == des->death_at
+				&& w->death_pos < des->death_pos))
+		{
+			des->death_at = w->death_at;
+			des->death_pos = w->death_pos;
+		}
+	}
+	des->windows++;
+	des->now += des->lookahead;
+	des->finished = (des->death_at != DES_INF || done == des->n
+			|| des->now >= des->horizon);
+	if (des->death_at != DES_INF)
+		des_discount(des);
+	else if (done < des->n)
+		des->end_at = des->now;
+}
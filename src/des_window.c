@@ -0,0 +1,84 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   des_window.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:10:26 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 14:02:10 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/* Moteur a evenements discrets (--des) : une fenetre [now, now + L[
+avec L = min(time_to_eat, time_to_sleep) (lookahead conservatif).
+Une fourchette prise est gardee au moins L ms (repas >= L), et un philo
+qui finit de manger dort au moins L ms : dans une fenetre, chaque
+fourchette change de main au plus une fois, et seuls les philos qui
+mangent deja a now peuvent en relacher une. Le sort de chaque fourchette
+ne depend donc que de ses deux voisins, en au plus DES_ROUNDS tours
+synchrones : le resultat ne depend pas du decoupage en segments. */
+
+/**
+ * @brief Etape 1 : ce que fait le philo p dans la fenetre, d'apres son
+ * seul etat a now (liberation, demande de sa premiere fourchette, ou
+ * demande de la seconde s'il tient deja la premiere). Remet aussi a
+ * zero le sort de sa fourchette de droite et son attribution.
+ * 
+ * @param des Moteur
+ * @param p Position du philo
+ */
+void	des_prepare(t_des *des, long p)
+{
+	t_des_philo	*x;
+	long		end;
+
+	x = des->philos + p;
+	end = des->now + des->lookahead;
+	x->rel = DES_INF;
+	x->req1 = DES_INF;
+	x->req2 = DES_INF;
+	x->meal_at = -1;
+	atomic_store_explicit(&des->forks[p].resolved, 0, memory_order_relaxed);
+	des->forks[p].grant_to = -1;
+	if (x->phase == DES_EAT && x->until < end)
+		x->rel = x->until;
+	else if (x->phase == DES_THINK && x->until < end)
+		x->req1 = x->until;
+	else if (x->phase == DES_SLEEP && x->until + des->think < end)
+		x->req1 = x->until + des->think;
+	else if (x->phase == DES_HUNGRY)
+		x->req1 = x->since;
+	else if (x->phase == DES_HOLD1)
+		x->req2 = x->since;
+}
+
+/**
+ * @brief Instant ou le philo x demande la fourchette f dans la fenetre.
+ * 
+ * Pour sa seconde fourchette, il faut connaitre le sort de la premiere,
+ * fixe a un tour precedent.
+ * 
+ * @return L'instant, DES_INF s'il ne la demande pas, -1 si inconnu
+ */
+long	des_request(t_des *des, long x, long f, int round)
+{
+	t_des_philo	*p;
+	t_des_fork	*first;
+	int			resolved;
+
+	p = des->philos + x;
+	if (p->first == f)
+		return (p->req1);
+	if (p->phase == DES_HOLD1)
+		return (p->req2);
+	first = des->forks + p->first;
+	resolved = atomic_load_explicit(&first->resolved, memory_order_relaxed);
+	if (resolved == 0 || resolved >= round)
+		return (-1);
+	if (first->grant_to == x)
+		return (first->grant_at);
+	return (DES_INF);
+}
@@ -6,7 +6,7 @@
 /*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/24 14:00:48 by marguima          #+#    #+#             */
-/*   Updated: 2026/01/27 13:07:40 by marguima         ###   ########.fr       */
+/*   Updated: 2026/10/21 12:40:11 by marguima         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -17,6 +17,12 @@
  * 
  * Un philosophe seul prend une fourchette et attend de mourir
  * car il ne peut pas manger avec une seule fourchette.
+ * Il bloque sur table_cond (wait_flag) dans les deux modes : a
+ * scruter end_simulation toutes les 200 us, il pouvait etre preempte
+ * en tenant table_mutex et bloquer le monitor sous charge (ligne
+ * "died" jusqu'a 30 ms en retard sur un seul coeur).
+ * Comme il ne mange jamais, son delai part du debut de la simulation
+ * (start_simulation) et non de son propre reveil apres la barriere.
  * 
  * @param arg Pointeur vers la structure t_philo
  * @return NULL
@@ -28,12 +34,13 @@ void	*alone_philo(void *arg)
 	philo = (t_philo *)arg;
 	wait_all_threads(philo->table);
 	set_long(&philo->philo_mutex, &philo->last_meal_time,
-		get_time(MILLISECOND));
+		philo->table->start_simulation);
+	deadline_arm(philo);
+	snapshot_publish(philo, THINKING);
 	increase_long(&philo->table->table_mutex,
 		&philo->table->threads_running_nb);
 	write_status(TAKE_FIRST_FORK, philo);
-	while (!simulation_finished(philo->table))
-		usleep(200);
+	wait_flag(philo->table, &philo->table->end_simulation);
 	return (NULL);
 }
 
@@ -50,43 +57,17 @@ void	*alone_philo(void *arg)
  * On utilise philo_nbr et non philo->id car avec philo->id,
  * certains philos attendent trop longtemps et meurent sur des
  * timings serres (ex: 4 410 200 200).
+ * philo_nbr est relu sous table_mutex : il change avec --elastic.
  *
  * @param philo Pointeur vers le philosophe
  */
 void	thinking(t_philo *philo)
 {
 	write_status(THINKING, philo);
-	if (philo->table->philo_nbr % 2 == 0)
+	if (get_long(&philo->table->table_mutex, &philo->table->philo_nbr) % 2
+		== 0)
 		return ;
-	precise_usleep(philo->table->time_to_eat / 2, philo->table);
-}
-
-/**
- * @brief Fait manger un philosophe.
- * 
- * Prend les deux fourchettes, met à jour last_meal_time,
- * incrémente le compteur de repas, dort pendant time_to_eat,
- * puis relâche les fourchettes. Marque le philo comme rassasié
- * si la limite de repas est atteinte.
- * 
- * @param philo Pointeur vers le philosophe
- */
-void	eat(t_philo *philo)
-{
-	safe_handle_mutex(&philo->first_fork->fork, LOCK);
-	write_status(TAKE_FIRST_FORK, philo);
-	safe_handle_mutex(&philo->second_fork->fork, LOCK);
-	write_status(TAKE_SECOND_FORK, philo);
-	set_long(&philo->philo_mutex, &philo->last_meal_time,
-		get_time(MILLISECOND));
-	philo->meals_counter++;
-	write_status(EATING, philo);
-	precise_usleep(philo->table->time_to_eat, philo->table);
-	if (philo->table->nbr_limit_meals > 0
-		&& philo->meals_counter == philo->table->nbr_limit_meals)
-		set_bool(&philo->philo_mutex, &philo->full, true);
-	safe_handle_mutex(&philo->first_fork->fork, UNLOCK);
-	safe_handle_mutex(&philo->second_fork->fork, UNLOCK);
+	elastic_rest(philo, philo->table->time_to_eat / 2);
 }
 
 /**
@@ -94,8 +75,8 @@ void	eat(t_philo *philo)
  * 
  * Attend que tous les threads soient prêts, puis entre dans
  * la boucle principale : manger, dormir, penser.
- * S'arrête si le philosophe est rassasié ou si la simulation
- * se termine.
+ * S'arrête si le philosophe est rassasié, s'il doit quitter la
+ * table (--elastic) ou si la simulation se termine.
  * 
  * @param data Pointeur vers la structure t_philo du philosophe
  * @return NULL
@@ -108,27 +89,59 @@ void	*dinner_simulation(void *data)
 	wait_all_threads(philo->table);
 	set_long(&philo->philo_mutex, &philo->last_meal_time,
 		get_time(MILLISECOND));
+	deadline_arm(philo);
+	snapshot_publish(philo, THINKING);
 	increase_long(&philo->table->table_mutex,
 		&philo->table->threads_running_nb);
 	if (philo->id % 2)
 		precise_usleep(philo->table->time_to_eat / 2, philo->table);
 	while (!simulation_finished(philo->table))
 	{
-		if (get_bool(&philo->philo_mutex, &philo->full))
+		if (get_bool(&philo->philo_mutex, &philo->full)
+			|| get_bool(&philo->philo_mutex, &philo->leaving))
 			break ;
 		eat(philo);
 		write_status(SLEEPING, philo);
-		precise_usleep(philo->table->time_to_sleep, philo->table);
+		elastic_rest(philo, philo->table->time_to_sleep);
 		thinking(philo);
 	}
 	return (NULL);
 }
 
+/**
+ * @brief Attend la fin de tous les threads de la simulation.
+ * 
+ * Le controleur --elastic est joint en premier : une fois qu'il est
+ * arrete, philo_nbr ne bouge plus et les philos encore assis sont
+ * exactement les places 0 a philo_nbr - 1.
+ * 
+ * @param table Pointeur vers la structure principale
+ */
+void	dinner_join(t_table *table)
+{
+	int	i;
+
+	if (table->opts.elastic_period > 0)
+		safe_thread_handle(&table->elastic.thread, NULL, NULL, JOIN);
+	i = -1;
+	while (table->philo_nbr > ++i)
+		safe_thread_handle(&table->philos[i].thread_id, NULL, NULL, JOIN);
+	wake_all(table, &table->end_simulation);
+	safe_thread_handle(&table->monitor, NULL, NULL, JOIN);
+	metrics_stop(table, NULL);
+	if (table->opts.elastic_period > 0)
+		elastic_report(table);
+	if (table->opts.cpu_report)
+		cpu_report(table);
+	if (table->opts.slack_report)
+		slack_report(table);
+}
+
 /**
  * @brief Lance la simulation des philosophes.
  * 
- * Crée un thread pour chaque philosophe, démarre la simulation,
- * puis attend que tous les threads se terminent.
+ * Crée un thread pour chaque philosophe (et le controleur --elastic),
+ * démarre la simulation, puis attend que tous les threads se terminent.
  * Gère le cas particulier d'un seul philosophe.
  * 
  * @param table Pointeur vers la structure principale
@@ -150,11 +163,12 @@ void	dinner_start(t_table *table)
 				&table->philos[i], CREATE);
 	}
 	safe_thread_handle(&table->monitor, monitor, table, CREATE);
+	if (table->opts.elastic_period > 0)
+		safe_thread_handle(&table->elastic.thread, elastic_routine, table,
+			CREATE);
 	table->start_simulation = get_time(MILLISECOND);
-	set_bool(&table->table_mutex, &table->all_ready, true);
-	i = -1;
-	while (table->philo_nbr > ++i)
-		safe_thread_handle(&table->philos[i].thread_id, NULL, NULL, JOIN);
-	set_bool(&table->table_mutex, &table->end_simulation, true);
-	safe_thread_handle(&table->monitor, NULL, NULL, JOIN);
+	metrics_start(table);
+	PROBE1(barrier_release, table->philo_nbr);
+	wake_all(table, &table->all_ready);
+	dinner_join(table);
 }
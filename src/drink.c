@@ -0,0 +1,117 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   drink.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 21:05:18 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 13:02:47 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "philo.h"
+
+/* --drinking=R : probleme des philosophes buveurs. Chaque place est
+reliee aux 2R bouteilles qui l'entourent (les forks philo_pos - R + 1 a
+philo_pos + R, donc ses deux fourchettes habituelles pour R = 1). A
+chaque session (repas), le philo demande un sous-ensemble de ces
+bouteilles, tire au hasard ou lu dans --drink-script. Chaque bouteille
+est un verrou a tickets (FIFO), et une session tire ses tickets sur
+toutes ses bouteilles d'un coup sous drink_lock : les sessions sont
+rangees dans le meme ordre dans toutes les files, donc aucun cycle
+d'attente n'est possible et une session n'attend que celles enregistrees
+avant elle (attente bornee). Prendre les bouteilles une a une par id
+croissant eviterait aussi l'interblocage, mais favorise les places qui
+visent les plus grands ids (indice de Jain 0,6 a 50 places, R = 2). */
+
+/**
+ * @brief Masque des bouteilles de la session a venir : bit j = j-ieme
+ * bouteille reliee. Le hasard ne tire jamais le masque vide ; un
+ * script peut le demander (session sans bouteille) ; check_drinking a
+ * deja refuse les masques de plus de 2R bits.
+ * 
+ * @param philo Philosophe qui commence une session
+ * @return Masque sur 2R bits
+ */
+long	drink_mask(t_philo *philo)
+{
+	t_options	*opts;
+	long		all;
+
+	opts = &philo->table->opts;
+	all = (1L << (2 * opts->drink_radius)) - 1;
+	if (opts->drink_script_len > 0)
+		return (opts->drink_script[philo->meals_counter
+				% opts->drink_script_len]);
+	return (rand_r(&philo->drink_seed) % all + 1);
+}
+
+/**
+ * @brief Tri par insertion des bouteilles par id croissant (2R <= 16).
+ * 
+ * @param philo Philosophe dont bottles est a trier
+ */
+void	drink_sort(t_philo *philo)
+{
+	t_fork	*cur;
+	int		i;
+	int		j;
+
+	i = 0;
+	while (++i < philo->bottle_nbr)
+	{
+		cur = philo->bottles[i];
+		j = i - 1;
+		while (j >= 0 && philo->bottles[j]->fork_id > cur->fork_id)
+		{
+			philo->bottles[j + 1] = philo->bottles[j];
+			j--;
+		}
+		philo->bottles[j + 1] = cur;
+	}
+}
+
+/**
+ * @brief Remplit philo->bottles avec les bouteilles de la session, dans
+ * l'ordre ou elles doivent etre prises.
+ * 
+ * @param philo Philosophe qui commence une session
+ */
+void	drink_pick(t_philo *philo)
+{
+	long	mask;
+	long	n;
+	long	r;
+	int		j;
+
+	mask = drink_mask(philo);
+	n = philo->table->philo_nbr;
+	r = philo->table->opts.drink_radius;
+	philo->bottle_nbr = 0;
+	j = -1;
+	while (++j < 2 * r)
+		if (mask >> j & 1)
+			philo->bottles[philo->bottle_nbr++] = philo->table->forks
+				+ (philo->id - r + j + n) % n;
+	drink_sort(philo);
+}
+
+/**
+ * @brief Remet les tickets de toutes les bouteilles a zero avant un run
+ * (un run arrete en pleine attente laisse des tickets non servis).
+ * 
+ * @param table Structure principale
+ */
+void	drink_reset(t_table *table)
+{
+	long	i;
+
+	i = -1;
+	while (++i < table->philo_cap)
+	{
+		atomic_init(&table->forks[i].next_ticket, 0);
+		atomic_init(&table->forks[i].serving, 0);
+	}
+}
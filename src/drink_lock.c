@@ -0,0 +1,96 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   drink_lock.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 21:12:40 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 13:02:47 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "philo.h"
+
+/**
+ * @brief Attend son tour sur la i-eme bouteille de la session, bloque
+ * sur sa condvar served (diffusee par drink_release) dans les deux
+ * modes, comme sur le mutex d'une fourchette. Le mutex fork de la
+ * bouteille, inutilise par --drinking, protege l'attente. Pas
+ * d'abandon a la fin de la simulation : la session servie avant nous
+ * rend toujours la bouteille (son precise_usleep s'interrompt), et un
+ * ticket abandonne bloquerait ceux qui suivent.
+ * 
+ * @param philo Philosophe qui attend
+ * @param i Index de la bouteille voulue dans philo->bottles
+ */
+void	drink_lock(t_philo *philo, int i)
+{
+	t_fork	*bottle;
+
+	bottle = philo->bottles[i];
+	PROBE2(fork_lock, philo->id, bottle->fork_id);
+	safe_handle_mutex(&bottle->fork, LOCK);
+	while (atomic_load(&bottle->serving) != philo->tickets[i])
+		pthread_cond_wait(&bottle->served, &bottle->fork);
+	safe_handle_mutex(&bottle->fork, UNLOCK);
+	PROBE2(fork_locked, philo->id, bottle->fork_id);
+}
+
+/**
+ * @brief --drinking, a la place de take_forks : choisit les bouteilles
+ * de la session, tire tous ses tickets d'un coup, puis attend chaque
+ * bouteille. Chacune est annoncee par une ligne "has taken a fork".
+ * 
+ * @param philo Philosophe qui commence une session
+ */
+void	drink_take(t_philo *philo)
+{
+	long	wait_start;
+	long	wait;
+	int		i;
+
+	wait_start = get_time(MICROSECOND);
+	drink_pick(philo);
+	safe_handle_mutex(&philo->table->drink_lock, LOCK);
+	i = -1;
+	while (++i < philo->bottle_nbr)
+		philo->tickets[i] = atomic_fetch_add(&philo->bottles[i]->next_ticket,
+				1);
+	safe_handle_mutex(&philo->table->drink_lock, UNLOCK);
+	i = -1;
+	while (++i < philo->bottle_nbr)
+	{
+		drink_lock(philo, i);
+		write_status(TAKE_FIRST_FORK, philo);
+	}
+	wait = get_time(MICROSECOND) - wait_start;
+	philo->fork_wait += wait;
+	if (wait > philo->max_fork_wait)
+		philo->max_fork_wait = wait;
+}
+/**
+ * @brief --drinking, a la place de release_forks : rend les bouteilles
+ * de la session (ticket suivant servi) et reveille leurs files. Tous
+ * les tickets en attente sont reveilles, seul le suivant repart.
+ * 
+ * @param philo Philosophe qui termine une session
+ */
+void	drink_release(t_philo *philo)
+{
+	t_fork	*bottle;
+	int		i;
+
+	snapshot_release_forks(philo);
+	i = -1;
+	while (++i < philo->bottle_nbr)
+	{
+		bottle = philo->bottles[i];
+		safe_handle_mutex(&bottle->fork, LOCK);
+		atomic_fetch_add(&bottle->serving, 1);
+		pthread_cond_broadcast(&bottle->served);
+		safe_handle_mutex(&bottle->fork, UNLOCK);
+		PROBE2(fork_unlock, philo->id, bottle->fork_id);
+	}
+}
@@ -0,0 +1,120 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   eat.c                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:20:09 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 13:02:47 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/* Repas d'un philosophe, decoupe en etapes. Tout se passe sous seat_lock :
+tant qu'il est tenu, first_fork/second_fork ne peuvent pas etre
+reassignes par le controleur --elastic. */
+
+/**
+ * @brief Prend les deux fourchettes dans l'ordre assigne.
+ * 
+ * Cumule le temps d'attente dans fork_wait pour les metrics et garde
+ * la plus longue dans max_fork_wait. Avec --slack-priority, cede
+ * d'abord la place a un voisin plus urgent.
+ * Sondes fork_lock (avant d'attendre) et fork_locked (fourchette
+ * obtenue) : id du philo, id de la fourchette.
+ * 
+ * @param philo Pointeur vers le philosophe
+ */
+void	take_forks(t_philo *philo)
+{
+	long	wait_start;
+	long	wait;
+
+	wait_start = get_time(MICROSECOND);
+	slack_yield(philo);
+	PROBE2(fork_lock, philo->id, philo->first_fork->fork_id);
+	safe_handle_mutex(&philo->first_fork->fork, LOCK);
+	PROBE2(fork_locked, philo->id, philo->first_fork->fork_id);
+	write_status(TAKE_FIRST_FORK, philo);
+	PROBE2(fork_lock, philo->id, philo->second_fork->fork_id);
+	safe_handle_mutex(&philo->second_fork->fork, LOCK);
+	PROBE2(fork_locked, philo->id, philo->second_fork->fork_id);
+	slack_clear(philo);
+	wait = get_time(MICROSECOND) - wait_start;
+	philo->fork_wait += wait;
+	if (wait > philo->max_fork_wait)
+		philo->max_fork_wait = wait;
+	write_status(TAKE_SECOND_FORK, philo);
+}
+
+/**
+ * @brief Commence le repas : met à jour last_meal_time et incrémente
+ * le compteur de repas.
+ * 
+ * Garde aussi le plus long ecart entre deux repas (max_meal_gap) pour
+ * mesurer l'effet des arrivees/departs sur les voisins, la marge du
+ * repas (--slack), et rearme l'echeance --timerfd.
+ * 
+ * @param philo Pointeur vers le philosophe
+ */
+void	start_meal(t_philo *philo)
+{
+	long	now;
+
+	now = get_time(MILLISECOND);
+	slack_record(philo, now);
+	if (now - philo->last_meal_time > philo->max_meal_gap)
+		philo->max_meal_gap = now - philo->last_meal_time;
+	set_long(&philo->philo_mutex, &philo->last_meal_time, now);
+	deadline_arm(philo);
+	philo->meals_counter++;
+	write_status(EATING, philo);
+}
+
+/**
+ * @brief Relâche les fourchettes.
+ * 
+ * La liberation est publiee dans la view avant les UNLOCK (snapshots).
+ * Sonde fork_unlock apres chaque UNLOCK.
+ * 
+ * @param philo Pointeur vers le philosophe
+ */
+void	release_forks(t_philo *philo)
+{
+	snapshot_release_forks(philo);
+	safe_handle_mutex(&philo->first_fork->fork, UNLOCK);
+	PROBE2(fork_unlock, philo->id, philo->first_fork->fork_id);
+	safe_handle_mutex(&philo->second_fork->fork, UNLOCK);
+	PROBE2(fork_unlock, philo->id, philo->second_fork->fork_id);
+}
+
+/**
+ * @brief Fait manger un philosophe.
+ * 
+ * Prend les deux fourchettes (ou, avec --drinking, les bouteilles de
+ * la session), commence le repas, dort pendant time_to_eat, puis
+ * relâche les fourchettes. Marque le philo comme
+ * rassasié si la limite de repas est atteinte.
+ * 
+ * @param philo Pointeur vers le philosophe
+ */
+void	eat(t_philo *philo)
+{
+	safe_handle_mutex(&philo->seat_lock, LOCK);
+	if (philo->table->opts.drink_radius)
+		drink_take(philo);
+	else
+		take_forks(philo);
+	start_meal(philo);
+	precise_usleep(philo->table->time_to_eat, philo->table);
+	if (philo->table->nbr_limit_meals > 0
+		&& philo->meals_counter == philo->table->nbr_limit_meals)
+		set_bool(&philo->philo_mutex, &philo->full, true);
+	if (philo->table->opts.drink_radius)
+		drink_release(philo);
+	else
+		release_forks(philo);
+	safe_handle_mutex(&philo->seat_lock, UNLOCK);
+}
@@ -0,0 +1,132 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   elastic.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:47:38 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 10:04:12 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/* Arrivees et departs de philosophes pendant la simulation (--elastic).
+Les tableaux philos/forks sont alloues a philo_cap places et ne bougent
+jamais : on ne fait que changer la taille de l'anneau. Les changements
+se font en fin d'anneau, entre le dernier philo et le philo 1, pour
+garder des ids contigus. Seul le dernier philo change de fourchette :
+on prend son seat_lock, ce qui garantit qu'il n'est pas dans eat(). */
+
+/**
+ * @brief Ajoute un philosophe a la place philo_nbr.
+ * 
+ * Le dernier philo lache la fourchette 0 au profit de la nouvelle
+ * fourchette philo_nbr, le nouveau s'assoit entre elle et la 0.
+ * Latence mesuree : de la demande au lancement du nouveau thread.
+ * 
+ * @param table Pointeur vers la structure principale
+ */
+void	elastic_join(t_table *table)
+{
+	long	n;
+	long	t0;
+	t_philo	*tail;
+	t_philo	*philo;
+
+	n = table->philo_nbr;
+	tail = table->philos + n - 1;
+	philo = table->philos + n;
+	t0 = get_time(MICROSECOND);
+	philo_seat(table, philo, n);
+	set_long(&philo->philo_mutex, &philo->last_meal_time,
+		get_time(MILLISECOND));
+	safe_handle_mutex(&tail->seat_lock, LOCK);
+	assign_fork(tail, table->forks, n - 1, n + 1);
+	assign_fork(philo, table->forks, n, n + 1);
+	ring_resize(table, n + 1);
+	safe_handle_mutex(&tail->seat_lock, UNLOCK);
+	safe_thread_handle(&philo->thread_id, dinner_simulation, philo, CREATE);
+	elastic_record(&table->elastic.joins, &table->elastic.join_us,
+		&table->elastic.join_max, get_time(MICROSECOND) - t0);
+	tail->churn_neighbour = true;
+	table->philos[0].churn_neighbour = true;
+}
+
+/**
+ * @brief Retire le dernier philosophe de l'anneau.
+ * 
+ * leaving est pose sous table_mutex puis table_cond est diffuse : un
+ * philo qui dort ou pense (elastic_rest) se reveille aussitot, un philo
+ * qui mange finit son repas. Il sort alors de sa boucle ; une fois
+ * son thread joint, l'anneau retrecit (le moniteur ne le surveille plus)
+ * et l'avant-dernier reprend la fourchette 0.
+ * Latence mesuree : de la demande au recablage de l'avant-dernier.
+ * 
+ * @param table Pointeur vers la structure principale
+ */
+void	elastic_leave(t_table *table)
+{
+	long	n;
+	long	t0;
+	t_philo	*philo;
+	t_philo	*prev;
+
+	n = table->philo_nbr;
+	philo = table->philos + n - 1;
+	prev = table->philos + n - 2;
+	t0 = get_time(MICROSECOND);
+	safe_handle_mutex(&table->table_mutex, LOCK);
+	set_bool(&philo->philo_mutex, &philo->leaving, true);
+	pthread_cond_broadcast(&table->table_cond);
+	safe_handle_mutex(&table->table_mutex, UNLOCK);
+	safe_thread_handle(&philo->thread_id, NULL, NULL, JOIN);
+	ring_resize(table, n - 1);
+	safe_handle_mutex(&table->table_mutex, LOCK);
+	table->threads_running_nb--;
+	safe_handle_mutex(&table->table_mutex, UNLOCK);
+	safe_handle_mutex(&prev->seat_lock, LOCK);
+	assign_fork(prev, table->forks, n - 2, n - 1);
+	safe_handle_mutex(&prev->seat_lock, UNLOCK);
+	elastic_record(&table->elastic.leaves, &table->elastic.leave_us,
+		&table->elastic.leave_max, get_time(MICROSECOND) - t0);
+	prev->churn_neighbour = true;
+	table->philos[0].churn_neighbour = true;
+}
+
+/**
+ * @brief Thread controleur : toutes les elastic_period ms, ajoute un
+ * philo jusqu'a philo_cap, puis en retire jusqu'a la taille de depart,
+ * et recommence.
+ * 
+ * S'arrete a la fin de la simulation ou quand tous sont rassasies.
+ * C'est le seul thread qui modifie philo_nbr pendant la simulation.
+ * 
+ * @param data Pointeur vers la structure t_table
+ * @return NULL
+ */
+void	*elastic_routine(void *data)
+{
+	t_table	*table;
+	bool	growing;
+
+	table = (t_table *)data;
+	wait_all_threads(table);
+	growing = true;
+	while (!simulation_finished(table) && !elastic_all_full(table))
+	{
+		precise_usleep(table->opts.elastic_period * MS_TO_US, table);
+		if (simulation_finished(table))
+			break ;
+		if (table->philo_nbr == table->philo_cap)
+			growing = false;
+		else if (table->philo_nbr == table->elastic.base)
+			growing = true;
+		if (growing)
+			elastic_join(table);
+		else
+			elastic_leave(table);
+	}
+	return (NULL);
+}
@@ -0,0 +1,132 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   elastic_utils.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:02:55 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 10:04:12 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/**
+ * @brief Change la taille de l'anneau et la publie partout ou elle est lue.
+ * 
+ * philo_nbr sous table_mutex (moniteur, thinking), ring_size pour les
+ * snapshots et philo_nbr de la page --metrics pour philo-top.
+ * 
+ * @param table Pointeur vers la structure principale
+ * @param n Nouvelle taille
+ */
+void	ring_resize(t_table *table, long n)
+{
+	set_long(&table->table_mutex, &table->philo_nbr, n);
+	atomic_store(&table->ring_size, n);
+	if (table->metrics)
+		atomic_store(&table->metrics->philo_nbr, n);
+}
+
+/**
+ * @brief Ajoute une mesure de latence aux stats du controleur.
+ * 
+ * @param count Compteur d'operations
+ * @param sum Somme des latences (us)
+ * @param max Latence maximale (us)
+ * @param us Latence mesuree (us)
+ */
+void	elastic_record(long *count, long *sum, long *max, long us)
+{
+	(*count)++;
+	*sum += us;
+	if (us > *max)
+		*max = us;
+}
+
+/**
+ * @brief Verifie si tous les philosophes assis sont rassasies.
+ * 
+ * @param table Pointeur vers la structure principale
+ * @return true si une limite de repas existe et que tous l'ont atteinte
+ */
+bool	elastic_all_full(t_table *table)
+{
+	long	i;
+
+	if (table->nbr_limit_meals <= 0)
+		return (false);
+	i = -1;
+	while (++i < table->philo_nbr)
+		if (!get_bool(&table->philos[i].philo_mutex, &table->philos[i].full))
+			return (false);
+	return (true);
+}
+
+/**
+ * @brief Affiche sur stderr les latences d'arrivee/depart et le plus long
+ * ecart entre deux repas, chez les voisins des changements et chez les
+ * autres.
+ * 
+ * @param table Pointeur vers la structure principale
+ */
+void	elastic_report(t_table *table)
+{
+	t_elastic	*e;
+	long		gap[2];
+	long		i;
+
+	e = &table->elastic;
+	gap[0] = 0;
+	gap[1] = 0;
+	i = -1;
+	while (++i < table->philo_cap)
+		if (table->philos[i].id && table->philos[i].max_meal_gap
+			> gap[table->philos[i].churn_neighbour])
+			gap[table->philos[i].churn_neighbour]
+				= table->philos[i].max_meal_gap;
+	fprintf(stderr, "elastic: %ld joins (avg %.1f ms, max %.1f ms), "
+		"%ld leaves (avg %.1f ms, max %.1f ms)\n", e->joins,
+		e->join_us / 1e3 / (e->joins + !e->joins), e->join_max / 1e3,
+		e->leaves, e->leave_us / 1e3 / (e->leaves + !e->leaves),
+		e->leave_max / 1e3);
+	fprintf(stderr, "elastic: max meal gap %ld ms for churn neighbours, "
+		"%ld ms for the others\n", gap[1], gap[0]);
+}
+
+/**
+ * @brief Sommeil et reflexion d'un philo : precise_usleep, sauf avec
+ * --elastic, ou l'attente bloque sur table_cond jusqu'a 1 ms de
+ * l'echeance pour qu'un depart (leaving, ecrit sous table_mutex) le
+ * reveille tout de suite au lieu d'attendre la fin de son cycle. La
+ * derniere milliseconde reste en precise_usleep. Tout retour non nul
+ * de pthread_cond_timedwait (ETIMEDOUT compris) sort de l'attente.
+ * 
+ * @param philo Philosophe qui se repose
+ * @param usec Duree en microsecondes
+ */
+void	elastic_rest(t_philo *philo, long usec)
+{
+	t_table			*table;
+	struct timespec	ts;
+	long			end;
+
+	table = philo->table;
+	end = get_time(MICROSECOND) + usec;
+	if (table->opts.elastic_period > 0 && usec > 1000)
+	{
+		ts.tv_sec = (end - 1000) / 1000000;
+		ts.tv_nsec = (end - 1000) % 1000000 * 1000;
+		safe_handle_mutex(&table->table_mutex, LOCK);
+		while (!table->end_simulation && !philo->leaving
+			&& pthread_cond_timedwait(&table->table_cond,
+				&table->table_mutex, &ts) == 0)
+			;
+		safe_handle_mutex(&table->table_mutex, UNLOCK);
+		if (get_bool(&philo->philo_mutex, &philo->leaving))
+			return ;
+	}
+	if (end > get_time(MICROSECOND))
+		precise_usleep(end - get_time(MICROSECOND), table);
+}
@@ -6,7 +6,7 @@
 /*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/22 20:47:45 by marguima          #+#    #+#             */
-/*   Updated: 2026/01/25 15:08:17 by marguima         ###   ########.fr       */
+/*   Updated: 2026/10/21 13:02:47 by marguima         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -21,80 +21,101 @@
  * Philosophes impairs: prennent d'abord la fourchette gauche, puis la droite
  * Philosophes pairs: prennent d'abord la fourchette droite, puis la gauche
  * Cette asymétrie garantit qu'au moins un philosophe peut toujours progresser
+ * (les philos 1 et 2 sont toujours d'orientation opposee, quelle que soit
+ * la taille de l'anneau, donc ca reste vrai avec --elastic).
  * 
  * @param philo Pointeur vers le philosophe à initialiser
  * @param forks Tableau de toutes les fourchettes disponibles sur la table
  * @param philo_pos Position du philosophe dans le tableau (index 0-based)
+ * @param ring Taille de l'anneau (philo_nbr courant)
  * 
  * @note La fourchette à droite est à l'index philo_pos
- * @note La fourchette à gauche est à l'index (philo_pos + 1) % philo_nbr.
+ * @note La fourchette à gauche est à l'index (philo_pos + 1) % ring.
  * (Le modulo fait boucler l'index pour que le dernier philosophe ait comme 
  * fourchette gauche la fourchette 0, créant ainsi la table circulaire)
  */
-void	assign_fork(t_philo *philo, t_fork *forks, int philo_pos)
+void	assign_fork(t_philo *philo, t_fork *forks, int philo_pos, long ring)
 {
-	int	philo_nbr;
-
-	philo_nbr = philo->table->philo_nbr;
 	philo->second_fork = &forks[philo_pos];
-	philo->first_fork = &forks[(philo_pos + 1) % philo_nbr];
+	philo->first_fork = &forks[(philo_pos + 1) % ring];
 	if (philo->id % 2 == 0)
 	{
 		philo->first_fork = &forks[philo_pos];
-		philo->second_fork = &forks[(philo_pos + 1) % philo_nbr];
+		philo->second_fork = &forks[(philo_pos + 1) % ring];
 	}
 }
 
 /**
- * @brief Initialise chaque philosophe à i + 1 (Premier philo == 1 pas 0) et
- * assigne les forks initialisés auparavant à chacun des philos via assign_fork
- * .
+ * @brief Installe un philosophe a la place pos (Premier philo == 1 pas 0)
+ * et publie une nouvelle version de sa view pour les snapshots.
+ * Sert au demarrage et a chaque arrivee --elastic : les mutex ne sont
+ * pas touches ici, ils sont initialises une seule fois par philo_init.
+ * 
+ * @param table Pointeur vers la structure principale
+ * @param philo Place a (re)initialiser
+ * @param pos Position dans le tableau (index 0-based)
+ */
+void	philo_seat(t_table *table, t_philo *philo, int pos)
+{
+	philo->id = pos + 1;
+	philo->full = false;
+	philo->leaving = false;
+	philo->churn_neighbour = false;
+	philo->meals_counter = 0;
+	philo->fork_wait = 0;
+	philo->max_fork_wait = 0;
+	philo->max_meal_gap = 0;
+	philo->last_meal_time = 0;
+	memset(&philo->slack, 0, sizeof(t_slack));
+	philo->bottle_nbr = 0;
+	philo->drink_seed = pos + 1;
+	philo->table = table;
+	view_write(philo, THINKING, 0);
+}
+
+/**
+ * @brief Remet a zero la view de toutes les places puis installe les
+ * philo_nbr premiers philosophes et leur assigne les forks via
+ * assign_fork. Ne touche ni aux mutex ni aux allocations.
  * 
  * @param table 
  */
-void	philo_init(t_table *table)
+void	philo_reset(t_table *table)
 {
 	int		i;
 	t_philo	*philo;
 
 	i = -1;
-	while (table->philo_nbr > ++i)
+	while (table->philo_cap > ++i)
 	{
 		philo = table->philos + i;
-		philo->id = i + 1;
-		philo->full = false;
-		philo->meals_counter = 0;
+		memset(philo->view, 0, sizeof(philo->view));
+		atomic_init(&philo->view_seq, 0);
+		philo->view_cur = 0;
+		philo->view_count = 0;
 		philo->table = table;
-		safe_handle_mutex(&philo->philo_mutex, INIT);
-		assign_fork(philo, table->forks, i);
+		philo->id = 0;
+		philo->max_meal_gap = 0;
+		if (i < table->philo_nbr)
+		{
+			philo_seat(table, philo, i);
+			assign_fork(philo, table->forks, i, table->philo_nbr);
+		}
 	}
 }
 
 /**
- * @brief Initialise le reste de la structure table
- * en allouant un tableau de philosophes et de forks.
- * Forks : INIT les mutex pour chaque fouchette du tableau
- * et leur assigne leur ID basé sur le nb de philosophes.
- * Philos : Appelle la fonction philo_init pour l'initialisation des philos.
+ * @brief Initialise tout ce qui observe la simulation sans y prendre
+ * part : page --metrics, sortie des statuts, trace, mesures --cpu-report.
  * 
- * @param table 
+ * @param table Pointeur vers la structure principale
  */
-void	data_init(t_table *table)
+void	observers_init(t_table *table)
 {
-	int	i;
-
-	i = -1;
-	table->end_simulation = false;
-	table->all_ready = false;
-	table->philos = safe_malloc(sizeof(t_philo) * table->philo_nbr);
-	table->threads_running_nb = 0;
-	safe_handle_mutex(&table->table_mutex, INIT);
-	safe_handle_mutex(&table->write_lock, INIT);
-	table->forks = safe_malloc(sizeof(t_fork) * table->philo_nbr);
-	while (table->philo_nbr > ++i)
-	{
-		safe_handle_mutex(&table->forks[i].fork, INIT);
-		table->forks[i].fork_id = i;
-	}
-	philo_init(table);
+	metrics_init(table);
+	out_init(table);
+	trace_init(table);
+	slack_init(table);
+	memset(&table->cpu, 0, sizeof(t_cpu));
+	atomic_init(&table->cpu.death_lag, -1);
 }
@@ -0,0 +1,147 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   libphilo.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 09:40:12 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 14:31:12 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "philo.h"
+
+/* Point d'entree de libphilo. Le handle garde la table (mutex, tableaux
+de places) et le pool de threads d'un run a l'autre : philo_run ne
+realloue et ne cree de threads que si le nouveau philo_nbr depasse ce
+qui existe deja. */
+
+/**
+ * @brief Cree un handle vide. A configurer avant le premier run.
+ * 
+ * @param sim Recoit le handle (NULL en cas d'echec)
+ * @return PHILO_OK, PHILO_EINVAL ou PHILO_ENOMEM
+ */
+t_philo_err	philo_create(t_philo_sim **sim)
+{
+	if (!sim)
+		return (PHILO_EINVAL);
+	*sim = calloc(1, sizeof(t_philo_sim));
+	if (!*sim)
+		return (PHILO_ENOMEM);
+	if (table_locks_init(&(*sim)->table))
+	{
+		if (pool_init(&(*sim)->pool, &(*sim)->table) == PHILO_OK)
+		{
+			atomic_init(&(*sim)->busy, false);
+			return (PHILO_OK);
+		}
+		table_locks_destroy(&(*sim)->table);
+	}
+	free(*sim);
+	*sim = NULL;
+	return (PHILO_ENOMEM);
+}
+
+/**
+ * @brief Valide et retient les parametres du prochain run. Refuse
+ * pendant un run (PHILO_ESTATE).
+ * 
+ * @param sim Handle
+ * @param config Parametres (copies, le pointeur n'est pas garde)
+ * @return PHILO_OK, PHILO_EINVAL ou PHILO_ESTATE
+ */
+t_philo_err	philo_configure(t_philo_sim *sim, const t_philo_config *config)
+{
+	t_philo_err	err;
+
+	if (!sim || !config)
+		return (PHILO_EINVAL);
+	if (atomic_load(&sim->busy))
+		return (PHILO_ESTATE);
+	err = lib_check(config);
+	if (err != PHILO_OK)
+		return (err);
+	sim->config = *config;
+	sim->configured = true;
+	return (PHILO_OK);
+}
+
+/**
+ * @brief Lance un run complet et bloque jusqu'a sa fin (deces, tous
+ * rassasies ou philo_stop). Un seul run a la fois par handle.
+ * 
+ * @param sim Handle configure
+ * @param result Issue du run (peut etre NULL)
+ * @return PHILO_OK, PHILO_EINVAL, PHILO_ENOMEM, PHILO_ETHREAD ou
+ * PHILO_ESTATE
+ */
+t_philo_err	philo_run(t_philo_sim *sim, t_philo_result *result)
+{
+	t_philo_err	err;
+
+	if (!sim)
+		return (PHILO_EINVAL);
+	if (!sim->configured || atomic_exchange(&sim->busy, true))
+		return (PHILO_ESTATE);
+	err = lib_prepare(sim);
+	if (err != PHILO_OK)
+	{
+		atomic_store(&sim->busy, false);
+		return (err);
+	}
+	safe_handle_mutex(&sim->table.table_mutex, LOCK);
+	sim->stopped = false;
+	sim->running = true;
+	safe_handle_mutex(&sim->table.table_mutex, UNLOCK);
+	pool_run(&sim->pool, &sim->table);
+	set_bool(&sim->table.table_mutex, &sim->running, false);
+	if (result)
+		lib_result(sim, result);
+	atomic_store(&sim->busy, false);
+	return (PHILO_OK);
+}
+
+/**
+ * @brief Demande la fin du run en cours, depuis n'importe quel thread
+ * (y compris le callback). philo_run rend la main une fois les threads
+ * joints.
+ * 
+ * @param sim Handle
+ * @return PHILO_OK, PHILO_EINVAL ou PHILO_ESTATE (aucun run en cours)
+ */
+t_philo_err	philo_stop(t_philo_sim *sim)
+{
+	if (!sim)
+		return (PHILO_EINVAL);
+	safe_handle_mutex(&sim->table.table_mutex, LOCK);
+	if (!sim->running)
+	{
+		safe_handle_mutex(&sim->table.table_mutex, UNLOCK);
+		return (PHILO_ESTATE);
+	}
+	sim->stopped = true;
+	sim->table.end_simulation = true;
+	pthread_cond_broadcast(&sim->table.table_cond);
+	pthread_cond_broadcast(&sim->table.slack_cond);
+	safe_handle_mutex(&sim->table.table_mutex, UNLOCK);
+	return (PHILO_OK);
+}
+
+/**
+ * @brief Arrete le pool et libere le handle. Ne doit pas etre appele
+ * pendant un run.
+ * 
+ * @param sim Handle (NULL accepte)
+ */
+void	philo_destroy(t_philo_sim *sim)
+{
+	if (!sim)
+		return ;
+	pool_destroy(&sim->pool);
+	data_free(&sim->table);
+	table_locks_destroy(&sim->table);
+	free(sim);
+}
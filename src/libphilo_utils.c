@@ -0,0 +1,120 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   libphilo_utils.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 09:52:31 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/20 12:02:40 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "philo.h"
+
+/**
+ * @brief Message lisible pour un code de retour de libphilo.
+ * 
+ * @param err Code de retour
+ * @return Chaine statique
+ */
+const char	*philo_strerror(t_philo_err err)
+{
+	if (err == PHILO_OK)
+		return ("success");
+	else if (err == PHILO_EINVAL)
+		return ("invalid argument");
+	else if (err == PHILO_ENOMEM)
+		return ("out of memory");
+	else if (err == PHILO_ETHREAD)
+		return ("thread creation failed");
+	else if (err == PHILO_ESTATE)
+		return ("operation not allowed in the current state");
+	return ("unknown error");
+}
+
+/**
+ * @brief Memes regles que parse_input, sans exit : au moins un philo,
+ * temps entre 60 ms et INT_MAX, limite de repas >= -1.
+ * 
+ * @param config Parametres a verifier
+ * @return PHILO_OK ou PHILO_EINVAL
+ */
+t_philo_err	lib_check(const t_philo_config *config)
+{
+	if (config->philo_nbr <= 0 || config->philo_nbr > INT_MAX)
+		return (PHILO_EINVAL);
+	if (config->time_to_die < 60 || config->time_to_eat < 60
+		|| config->time_to_sleep < 60)
+		return (PHILO_EINVAL);
+	if (config->time_to_die > INT_MAX || config->time_to_eat > INT_MAX
+		|| config->time_to_sleep > INT_MAX)
+		return (PHILO_EINVAL);
+	if (config->nbr_limit_meals < -1 || config->nbr_limit_meals > INT_MAX)
+		return (PHILO_EINVAL);
+	return (PHILO_OK);
+}
+
+/**
+ * @brief Copie la configuration dans la table, (re)alloue les places
+ * si la capacite ne suffit pas, remet la table a l'etat de depart et
+ * complete le pool de threads (philo_nbr + 1).
+ * 
+ * @param sim Handle
+ * @return PHILO_OK, PHILO_ENOMEM ou PHILO_ETHREAD
+ */
+t_philo_err	lib_prepare(t_philo_sim *sim)
+{
+	t_table	*table;
+
+	table = &sim->table;
+	if (table->philos && sim->config.philo_nbr > table->philo_cap)
+		data_free(table);
+	table->philo_nbr = sim->config.philo_nbr;
+	table->time_to_die = sim->config.time_to_die * MS_TO_US;
+	table->time_to_eat = sim->config.time_to_eat * MS_TO_US;
+	table->time_to_sleep = sim->config.time_to_sleep * MS_TO_US;
+	table->nbr_limit_meals = sim->config.nbr_limit_meals;
+	table->opts.low_cpu = sim->config.low_cpu;
+	table->opts.on_event = sim->config.on_event;
+	table->opts.user = sim->config.user;
+	if (!table->philos)
+	{
+		table->philo_cap = table->philo_nbr;
+		if (!data_alloc(table))
+			return (PHILO_ENOMEM);
+	}
+	data_reset(table);
+	table->start_simulation = get_time(MILLISECOND);
+	return (pool_grow(&sim->pool, table->philo_nbr + 1));
+}
+
+/**
+ * @brief Remplit le resultat d'un run termine (threads joints).
+ * 
+ * @param sim Handle
+ * @param result Resultat a remplir
+ */
+void	lib_result(t_philo_sim *sim, t_philo_result *result)
+{
+	int		i;
+	long	meals;
+	t_table	*table;
+
+	table = &sim->table;
+	result->stopped = sim->stopped;
+	result->dead_id = table->dead_id;
+	result->dead_at = table->dead_at;
+	result->duration = get_time(MILLISECOND) - table->start_simulation;
+	result->meals_min = 0;
+	result->meals_total = 0;
+	i = -1;
+	while (table->philo_nbr > ++i)
+	{
+		meals = table->philos[i].meals_counter;
+		if (i == 0 || meals < result->meals_min)
+			result->meals_min = meals;
+		result->meals_total += meals;
+	}
+}
@@ -0,0 +1,121 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   locks_init.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/21 10:58:30 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 14:31:12 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "philo.h"
+
+/* Initialisation des mutex et condvars sans exit : en cas d'echec,
+chaque fonction detruit ce qu'elle a deja initialise et rend false.
+libphilo en fait un PHILO_ENOMEM, le programme un message d'erreur. */
+
+/**
+ * @brief Initialise table_mutex, table_cond, slack_cond et write_lock.
+ * 
+ * @param table Structure principale
+ * @return false si une initialisation echoue (rien ne reste initialise)
+ */
+bool	table_locks_init(t_table *table)
+{
+	if (pthread_mutex_init(&table->table_mutex, NULL))
+		return (false);
+	if (pthread_cond_init(&table->table_cond, NULL) == 0)
+	{
+		if (pthread_cond_init(&table->slack_cond, NULL) == 0)
+		{
+			if (pthread_mutex_init(&table->write_lock, NULL) == 0)
+				return (true);
+			pthread_cond_destroy(&table->slack_cond);
+		}
+		pthread_cond_destroy(&table->table_cond);
+	}
+	pthread_mutex_destroy(&table->table_mutex);
+	return (false);
+}
+
+/**
+ * @brief Detruit ce que table_locks_init a initialise.
+ * 
+ * @param table Structure principale
+ */
+void	table_locks_destroy(t_table *table)
+{
+	safe_handle_mutex(&table->write_lock, DESTROY);
+	safe_handle_mutex(&table->table_mutex, DESTROY);
+	pthread_cond_destroy(&table->table_cond);
+	pthread_cond_destroy(&table->slack_cond);
+}
+
+/**
+ * @brief Initialise les mutex d'une place : sa fourchette (et sa condvar
+ * served pour --drinking), philo_mutex et seat_lock.
+ * 
+ * @param table Structure principale
+ * @param i Index de la place
+ * @return false si une initialisation echoue (rien ne reste initialise
+ * pour cette place)
+ */
+bool	seat_lock_init(t_table *table, long i)
+{
+	table->forks[i].fork_id = i;
+	if (pthread_mutex_init(&table->forks[i].fork, NULL))
+		return (false);
+	if (pthread_cond_init(&table->forks[i].served, NULL) == 0)
+	{
+		if (pthread_mutex_init(&table->philos[i].philo_mutex, NULL) == 0)
+		{
+			if (pthread_mutex_init(&table->philos[i].seat_lock, NULL) == 0)
+				return (true);
+			pthread_mutex_destroy(&table->philos[i].philo_mutex);
+		}
+		pthread_cond_destroy(&table->forks[i].served);
+	}
+	pthread_mutex_destroy(&table->forks[i].fork);
+	return (false);
+}
+
+/**
+ * @brief Initialise les mutex des philo_cap places puis le verrou des
+ * tickets --drinking.
+ * 
+ * @param table Structure principale (tableaux deja alloues)
+ * @return false si une initialisation echoue (rien ne reste initialise)
+ */
+bool	seat_locks_init(t_table *table)
+{
+	long	i;
+
+	i = 0;
+	while (i < table->philo_cap && seat_lock_init(table, i))
+		i++;
+	if (i == table->philo_cap
+		&& pthread_mutex_init(&table->drink_lock, NULL) == 0)
+		return (true);
+	seat_locks_destroy(table, i);
+	return (false);
+}
+
+/**
+ * @brief Detruit les mutex des n premieres places.
+ * 
+ * @param table Structure principale
+ * @param n Nombre de places initialisees
+ */
+void	seat_locks_destroy(t_table *table, long n)
+{
+	while (n-- > 0)
+	{
+		safe_handle_mutex(&table->philos[n].philo_mutex, DESTROY);
+		safe_handle_mutex(&table->philos[n].seat_lock, DESTROY);
+		safe_handle_mutex(&table->forks[n].fork, DESTROY);
+		pthread_cond_destroy(&table->forks[n].served);
+	}
+}
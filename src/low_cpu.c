@@ -0,0 +1,110 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   low_cpu.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 17:12:50 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 14:31:12 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/* --low-cpu : toutes les attentes bloquent sur table_cond (avec
+table_mutex) au lieu de tourner. wake_all est appele a chaque
+changement de all_ready ou end_simulation, dans les deux modes (il
+reveille aussi les philos qui cedent leur tour sur slack_cond). */
+
+/**
+ * @brief Met flag a true sous table_mutex et reveille les attentes.
+ * 
+ * @param table Structure principale
+ * @param flag all_ready ou end_simulation
+ */
+void	wake_all(t_table *table, bool *flag)
+{
+	safe_handle_mutex(&table->table_mutex, LOCK);
+	*flag = true;
+	pthread_cond_broadcast(&table->table_cond);
+	pthread_cond_broadcast(&table->slack_cond);
+	safe_handle_mutex(&table->table_mutex, UNLOCK);
+}
+
+/**
+ * @brief Bloque jusqu'a ce que flag passe a true (via wake_all).
+ * 
+ * @param table Structure principale
+ * @param flag all_ready ou end_simulation
+ */
+void	wait_flag(t_table *table, bool *flag)
+{
+	safe_handle_mutex(&table->table_mutex, LOCK);
+	while (!*flag)
+		pthread_cond_wait(&table->table_cond, &table->table_mutex);
+	safe_handle_mutex(&table->table_mutex, UNLOCK);
+}
+
+/**
+ * @brief Bloque jusqu'a deadline (us, horloge de get_time) ou jusqu'a
+ * la fin de la simulation.
+ * 
+ * @param table Structure principale
+ * @param deadline Heure de reveil en microsecondes
+ */
+void	sleep_until(t_table *table, long deadline)
+{
+	struct timespec	ts;
+
+	ts.tv_sec = deadline / 1000000;
+	ts.tv_nsec = deadline % 1000000 * 1000;
+	safe_handle_mutex(&table->table_mutex, LOCK);
+	while (!table->end_simulation && get_time(MICROSECOND) < deadline)
+		if (pthread_cond_timedwait(&table->table_cond, &table->table_mutex,
+				&ts) == ETIMEDOUT)
+			break ;
+	safe_handle_mutex(&table->table_mutex, UNLOCK);
+}
+
+/**
+ * @brief Echeance (us) d'une copie de philo : dernier repas publie +
+ * time_to_die + 1 ms, LONG_MAX s'il est rassasie.
+ * 
+ * @param table Structure principale
+ * @param p Copie du philo (snapshot ou lecture d'une place)
+ * @return Echeance en microsecondes
+ */
+long	snap_deadline(t_table *table, t_philo_snap *p)
+{
+	if (table->nbr_limit_meals > 0 && p->meals >= table->nbr_limit_meals)
+		return (LONG_MAX);
+	return ((p->last_meal + 1) * 1000 + table->time_to_die);
+}
+
+/**
+ * @brief Premier instant (us) ou un philo peut mourir, calcule sur les
+ * copies du snapshot que le moniteur vient de prendre : aucun verrou.
+ * 
+ * last_meal_time ne fait qu'augmenter et une view peut retarder sur
+ * le dernier repas, jamais le devancer : l'echeance d'une copie est au
+ * plus tot celle du philo, le moniteur se reveille trop tot plutot que
+ * trop tard. Il en va de meme des copies d'un snapshot incomplet et
+ * d'un philo qui arrive (--elastic), dont l'echeance est plus lointaine.
+ * 
+ * @param table Structure principale
+ * @param snap Snapshot du passage (table->scan)
+ * @return Echeance en microsecondes, LONG_MAX si tous sont rassasies
+ */
+long	next_death(t_table *table, t_snapshot *snap)
+{
+	long	deadline;
+	long	i;
+
+	deadline = LONG_MAX;
+	i = -1;
+	while (++i < snap->philo_nbr)
+		if (snap_deadline(table, snap->philos + i) < deadline)
+			deadline = snap_deadline(table, snap->philos + i);
+	return (deadline);
+}
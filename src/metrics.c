@@ -0,0 +1,148 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   metrics.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:41:17 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 09:12:44 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+#include <sys/mman.h>
+#include <fcntl.h>
+
+/* Page de stats publiee en memoire partagee POSIX (--metrics) pour
+philo-top. Chaque philo ecrit uniquement sa propre ligne sous seqlock :
+l'ecrivain ne bloque jamais, c'est le lecteur qui reessaie. */
+
+/**
+ * @brief Cree et mappe le segment shm, une ligne par place (philo_cap).
+ * Ne fait rien si --metrics n'a pas ete demande.
+ * Le segment est recree a chaque lancement pour repartir de zero ; en
+ * cas d'echec de ftruncate, le descripteur est ferme et le segment
+ * supprime avant de quitter.
+ * 
+ * @param table Pointeur vers la structure principale
+ */
+void	metrics_init(t_table *table)
+{
+	int		fd;
+
+	table->metrics = NULL;
+	if (!table->opts.metrics_name)
+		return ;
+	table->metrics_size = sizeof(t_metrics)
+		+ sizeof(t_metrics_slot) * table->philo_cap;
+	shm_unlink(table->opts.metrics_name);
+	fd = shm_open(table->opts.metrics_name, O_CREAT | O_RDWR, 0644);
+	if (fd < 0)
+		error("Philo : Metrics shared memory failed.\n");
+	if (ftruncate(fd, table->metrics_size) < 0)
+	{
+		close(fd);
+		shm_unlink(table->opts.metrics_name);
+		error("Philo : Metrics shared memory failed.\n");
+	}
+	table->metrics = mmap(NULL, table->metrics_size,
+			PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (table->metrics == MAP_FAILED)
+		error("Philo : Metrics mmap failed.\n");
+}
+
+/**
+ * @brief Remplit l'entete de la page au depart de la simulation.
+ * 
+ * Les lignes (id, etat initial) sont remplies ici, avant le magic :
+ * les philos attendent encore la barriere de depart. Le magic est ecrit
+ * en dernier (release) : un lecteur qui le voit voit aussi le reste.
+ * 
+ * @param table Pointeur vers la structure principale
+ */
+void	metrics_start(t_table *table)
+{
+	t_metrics	*page;
+	long		i;
+
+	page = table->metrics;
+	if (!page)
+		return ;
+	i = -1;
+	while (++i < table->philo_cap)
+	{
+		page->slots[i].id = i + 1;
+		atomic_store(&page->slots[i].state, THINKING);
+	}
+	atomic_store(&page->philo_nbr, table->philo_nbr);
+	page->time_to_die = table->time_to_die / 1e3;
+	page->time_to_eat = table->time_to_eat / 1e3;
+	page->time_to_sleep = table->time_to_sleep / 1e3;
+	atomic_store(&page->start_simulation, table->start_simulation);
+	atomic_store(&page->running, 1);
+	atomic_store_explicit(&page->magic, METRICS_MAGIC, memory_order_release);
+}
+
+/**
+ * @brief Publie l'etat courant d'un philosophe dans sa ligne.
+ * 
+ * Appele uniquement par le thread du philo lui-meme : il est le seul
+ * ecrivain de sa ligne et peut lire ses propres champs sans mutex.
+ * 
+ * @param philo Pointeur vers le philosophe
+ * @param status Nouvel etat a publier
+ */
+void	metrics_publish(t_philo *philo, t_philo_status status)
+{
+	t_metrics_slot	*slot;
+
+	if (!philo->table->metrics)
+		return ;
+	slot = &philo->table->metrics->slots[philo->id - 1];
+	seq_write_begin(&slot->seq);
+	atomic_store_explicit(&slot->state, status, memory_order_relaxed);
+	atomic_store_explicit(&slot->meals, philo->meals_counter,
+		memory_order_relaxed);
+	atomic_store_explicit(&slot->last_meal, philo->last_meal_time
+		- philo->table->start_simulation, memory_order_relaxed);
+	atomic_store_explicit(&slot->fork_wait, philo->fork_wait,
+		memory_order_relaxed);
+	seq_write_end(&slot->seq);
+}
+
+/**
+ * @brief Marque la fin de la simulation dans la page.
+ * 
+ * Le deces est publie dans l'entete (dead_id) et non dans la ligne
+ * du philo : c'est le moniteur qui l'ecrit, pas le thread du philo.
+ * 
+ * @param table Pointeur vers la structure principale
+ * @param dead Philosophe mort, ou NULL pour une fin normale
+ */
+void	metrics_stop(t_table *table, t_philo *dead)
+{
+	if (!table->metrics)
+		return ;
+	if (dead)
+		atomic_store(&table->metrics->dead_id, dead->id);
+	atomic_store(&table->metrics->running, 0);
+}
+
+/**
+ * @brief Demappe et supprime le segment shm.
+ * 
+ * Un philo-top deja attache garde son mapping et peut afficher
+ * l'etat final.
+ * 
+ * @param table Pointeur vers la structure principale
+ */
+void	metrics_destroy(t_table *table)
+{
+	if (!table->metrics)
+		return ;
+	munmap(table->metrics, table->metrics_size);
+	shm_unlink(table->opts.metrics_name);
+	table->metrics = NULL;
+}
@@ -6,7 +6,7 @@
 /*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/24 15:20:25 by marguima          #+#    #+#             */
-/*   Updated: 2026/01/25 15:18:22 by marguima         ###   ########.fr       */
+/*   Updated: 2026/10/21 13:31:40 by marguima         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -17,6 +17,9 @@
  * 
  * Compare le temps écoulé depuis le dernier repas avec le
  * time_to_die. Retourne false si le philosophe est rassasié.
+ * Sonde death (id, ms depuis le dernier repas) quand le deces est
+ * constate. Avec --shards, plusieurs threads peuvent constater un
+ * deces : seul le premier ecrit death_lag (echange atomique depuis -1).
  * 
  * @param philo Pointeur vers le philosophe à vérifier
  * @return true si le philosophe est mort, false sinon
@@ -25,6 +28,7 @@ bool	philo_died(t_philo *philo)
 {
 	long	elapsed;
 	long	t_to_die;
+	long	none;
 
 	if (get_bool(&philo->philo_mutex, &philo->full))
 		return (false);
@@ -32,15 +36,94 @@ bool	philo_died(t_philo *philo)
 		- get_long(&philo->philo_mutex, &philo->last_meal_time);
 	t_to_die = philo->table->time_to_die / 1e3;
 	if (elapsed > t_to_die)
+	{
+		none = -1;
+		atomic_compare_exchange_strong(&philo->table->cpu.death_lag, &none,
+			elapsed - t_to_die - 1);
+		PROBE2(death, philo->id, elapsed);
 		return (true);
+	}
 	return (false);
 }
 
+/**
+ * @brief Termine la simulation sur le deces de philo : reveille les
+ * attentes puis ecrit l'unique ligne "died".
+ * 
+ * @param table Pointeur vers la structure t_table
+ * @param philo Philosophe mort
+ */
+void	monitor_report(t_table *table, t_philo *philo)
+{
+	wake_all(table, &table->end_simulation);
+	write_status(DIED, philo);
+}
+
+/**
+ * @brief Vrai si la copie d'un philo dans le snapshot du monitor le
+ * montre mort : pas encore rassasie et plus de time_to_die depuis son
+ * dernier repas publie.
+ * 
+ * @param table Structure principale
+ * @param p Copie du philo
+ * @param now Instant de la prise du snapshot (ms)
+ */
+bool	monitor_suspect(t_table *table, t_philo_snap *p, long now)
+{
+	if (table->nbr_limit_meals > 0 && p->meals >= table->nbr_limit_meals)
+		return (false);
+	return (now - p->last_meal > table->time_to_die / 1e3);
+}
+
+/**
+ * @brief Detection par scan : prend en boucle un snapshot sans verrou
+ * de la table (snapshot_take, taille de l'anneau comprise pour
+ * --elastic) et ne relit sous mutex (philo_died) que les suspects : la
+ * view d'un philo qui vient de commencer a manger peut encore montrer
+ * son repas precedent. Si le snapshot echoue, tous sont relus. Chaque
+ * passage vide aussi la sortie rapide si besoin (out_tick).
+ * Avec --low-cpu, dort entre deux passages jusqu'a la premiere
+ * echeance possible, calculee sur les memes copies (next_death) : un
+ * passage ne prend de verrou que pour les suspects. Sans, dort
+ * jusqu'a MONITOR_SPIN_US avant et ne tourne qu'ensuite : un monitor
+ * qui tourne en continu partage son coeur a parts egales avec tout
+ * autre thread occupe et peut perdre une tranche entiere de
+ * l'ordonnanceur (plus de 10 ms) juste avant un deces, alors qu'un
+ * thread qui se reveille passe devant.
+ * 
+ * @param table Pointeur vers la structure t_table
+ */
+void	monitor_scan(t_table *table)
+{
+	long	i;
+	bool	ok;
+
+	while (!simulation_finished(table))
+	{
+		ok = snapshot_take(table, &table->scan);
+		i = -1;
+		while (++i < table->scan.philo_nbr)
+			if ((!ok || monitor_suspect(table, table->scan.philos + i,
+						table->scan.taken_at))
+				&& !simulation_finished(table)
+				&& philo_died(table->philos + i))
+				monitor_report(table, table->philos + i);
+		out_tick(table);
+		if (table->opts.low_cpu)
+			sleep_until(table, next_death(table, &table->scan));
+		else
+			sleep_until(table, next_death(table, &table->scan)
+				- MONITOR_SPIN_US);
+	}
+}
+
 /**
  * @brief Thread de surveillance qui vérifie si un philo est mort.
  * 
- * Attend que tous les threads soient lancés, puis vérifie en
- * boucle si un philosophe est mort. Met fin à la simulation
+ * Attend que tous les threads soient lancés, puis surveille la table
+ * par scan (monitor_scan) ou, avec --timerfd, en attendant les
+ * echeances dans epoll (deadline_watch). Avec --shards, coordonne les
+ * threads de tranche (shard_coordinate). Met fin à la simulation
  * dès qu'un décès est détecté.
  * 
  * @param data Pointeur vers la structure t_table
@@ -48,24 +131,18 @@ bool	philo_died(t_philo *philo)
  */
 void	*monitor(void *data)
 {
-	int		i;
 	t_table	*table;
 
 	table = (t_table *)data;
 	while (!all_threads_running(&table->table_mutex, &table->threads_running_nb,
 			table->philo_nbr))
-		;
-	while (!simulation_finished(table))
-	{
-		i = -1;
-		while (table->philo_nbr > ++i && !simulation_finished(table))
-		{
-			if (philo_died(table->philos + i))
-			{
-				set_bool(&table->table_mutex, &table->end_simulation, true);
-				write_status(DIED, table->philos + i);
-			}
-		}
-	}
+		if (table->opts.low_cpu)
+			sleep_until(table, get_time(MICROSECOND) + 1000);
+	if (table->opts.timerfd)
+		deadline_watch(table);
+	else if (table->opts.shards > 1)
+		shard_coordinate(table);
+	else
+		monitor_scan(table);
 	return (NULL);
 }
@@ -0,0 +1,143 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   options.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:12:04 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 14:44:51 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/* Options longues facultatives, placees apres les arguments numeriques.
+Chaque option a son propre handler (options_handlers.c) pour garder
+set_option lisible ; la table ci-dessous associe chaque nom a son
+handler. */
+
+static const t_option	g_options[] = {
+	{"--metrics", opt_metrics},
+	{"--max-philos", opt_max_philos},
+	{"--elastic", opt_elastic},
+	{"--des-threads", opt_des_threads},
+	{"--des-check", opt_des_check},
+	{"--des", opt_des},
+	{"--solve", opt_solve},
+	{"--low-cpu", opt_low_cpu},
+	{"--cpu-report", opt_cpu_report},
+	{"--fast-output", opt_fast_output},
+	{"--output", opt_output},
+	{"--trace", opt_trace},
+	{"--timerfd", opt_timerfd},
+	{"--slack-priority", opt_slack_priority},
+	{"--slack", opt_slack},
+	{"--shards", opt_shards},
+	{"--drinking", opt_drinking},
+	{"--drink-script", opt_drink_script},
+	{NULL, NULL}};
+
+/**
+ * @brief Retourne la valeur d'une option si arg correspond a name.
+ * 
+ * @param arg Argument brut (ex: "--metrics=/demo")
+ * @param name Nom de l'option (ex: "--metrics")
+ * @return "" pour "--name", "val" pour "--name=val", NULL sinon
+ */
+char	*option_value(char *arg, char *name)
+{
+	size_t	len;
+
+	len = strlen(name);
+	if (strncmp(arg, name, len) != 0)
+		return (NULL);
+	if (arg[len] == '\0')
+		return (arg + len);
+	if (arg[len] == '=')
+		return (arg + len + 1);
+	return (NULL);
+}
+
+/**
+ * @brief Cherche le handler correspondant a arg et l'applique.
+ * EXIT avec un message d'erreur si l'option est inconnue.
+ * 
+ * @param table Structure principale
+ * @param arg Argument commencant par "--"
+ */
+void	set_option(t_table *table, char *arg)
+{
+	int		i;
+	char	*val;
+
+	i = -1;
+	while (g_options[++i].name)
+	{
+		val = option_value(arg, g_options[i].name);
+		if (val)
+		{
+			g_options[i].apply(table, val);
+			return ;
+		}
+	}
+	error("Syntax error : Unknown option\n");
+}
+
+/**
+ * @brief Extrait les options "--..." de av et compacte les arguments
+ * numeriques au debut du tableau, pour que main et parse_input
+ * continuent de travailler sur av[1] a av[5].
+ * 
+ * @param table Structure de donnee initialisee dans le main
+ * @param ac Nombre d'arguments
+ * @param av Arguments passes au programme (modifie en place)
+ * @return Le nouveau ac, sans les options
+ */
+int	parse_options(t_table *table, int ac, char **av)
+{
+	int	i;
+	int	kept;
+
+	memset(&table->opts, 0, sizeof(t_options));
+	i = 0;
+	kept = 1;
+	while (++i < ac)
+	{
+		if (strncmp(av[i], "--", 2) == 0)
+			set_option(table, av[i]);
+		else
+			av[kept++] = av[i];
+	}
+	av[kept] = NULL;
+	return (kept);
+}
+
+/**
+ * @brief Verifie la coherence des options une fois les nombres lus
+ * et fixe la capacite des tableaux (philo_cap). --max-philos n'a de sens
+ * qu'avec --elastic.
+ * 
+ * @param table Structure de donnee initialisee dans le main
+ */
+void	check_options(t_table *table)
+{
+	table->philo_cap = table->philo_nbr;
+	memset(&table->elastic, 0, sizeof(t_elastic));
+	if (table->opts.des_threads <= 0)
+		table->opts.des_threads = sysconf(_SC_NPROCESSORS_ONLN);
+	check_drinking(table);
+	check_output(table);
+	if (table->opts.elastic_period <= 0 && table->opts.max_philos)
+		error("Syntax error : --max-philos needs --elastic\n");
+	if (table->opts.elastic_period <= 0)
+		return ;
+	if (table->philo_nbr < 2)
+		error("Syntax error : --elastic needs at least 2 philosophers\n");
+	table->philo_cap = table->opts.max_philos;
+	if (table->philo_cap == 0)
+		table->philo_cap = table->philo_nbr * 2;
+	if (table->philo_cap <= table->philo_nbr)
+		error("Syntax error : --max-philos must be above Nb philo\n");
+	table->elastic.base = table->philo_nbr;
+}
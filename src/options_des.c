@@ -0,0 +1,66 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   options_des.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:44:18 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/19 16:52:30 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/* Handlers des options qui remplacent la simulation en temps reel :
+moteur a evenements discrets (des_*.c) et solveur (solve.c). */
+
+/**
+ * @brief --des=MS : simule en temps virtuel jusqu'a MS ms (moteur DES).
+ * 
+ * @param table Structure principale
+ * @param val Horizon en millisecondes
+ */
+void	opt_des(t_table *table, char *val)
+{
+	table->opts.des_horizon = ft_atol(val);
+	if (table->opts.des_horizon <= 0)
+		error("Syntax error : --des expects a horizon in ms\n");
+}
+
+/**
+ * @brief --des-threads=K : nombre de workers du moteur DES.
+ * 
+ * @param table Structure principale
+ * @param val Nombre de threads
+ */
+void	opt_des_threads(t_table *table, char *val)
+{
+	table->opts.des_threads = ft_atol(val);
+	if (table->opts.des_threads <= 0)
+		error("Syntax error : --des-threads expects a thread count\n");
+}
+
+/**
+ * @brief --des-check : rejoue avec un seul worker et compare le resultat.
+ * 
+ * @param table Structure principale
+ * @param val Ignore
+ */
+void	opt_des_check(t_table *table, char *val)
+{
+	(void)val;
+	table->opts.des_check = true;
+}
+
+/**
+ * @brief --solve : donne l'issue sans simuler quand elle est certaine.
+ * 
+ * @param table Structure principale
+ * @param val Ignore
+ */
+void	opt_solve(t_table *table, char *val)
+{
+	(void)val;
+	table->opts.solve = true;
+}
@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   options_drink.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 21:20:02 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 13:02:47 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "philo.h"
+
+/* Handlers des options du mode buveurs (drink.c). */
+
+/**
+ * @brief --drinking=R : sessions sur des sous-ensembles des 2R
+ * bouteilles voisines au lieu de deux fourchettes fixes.
+ * 
+ * @param table Structure principale
+ * @param val Rayon R (1 a DRINK_MAX / 2)
+ */
+void	opt_drinking(t_table *table, char *val)
+{
+	table->opts.drink_radius = ft_atol(val);
+	if (table->opts.drink_radius <= 0
+		|| table->opts.drink_radius > DRINK_MAX / 2)
+		error("Syntax error : --drinking expects a radius from 1 to 8\n");
+}
+
+/**
+ * @brief --drink-script=M1,M2,... : masques des sessions successives
+ * (bit j = j-ieme bouteille reliee), repris en boucle. Chaque champ
+ * doit contenir un nombre : "3,,5" et "3," sont refuses.
+ * 
+ * @param table Structure principale
+ * @param val Liste de masques separes par des virgules
+ */
+void	opt_drink_script(t_table *table, char *val)
+{
+	long	*len;
+	long	mask;
+
+	len = &table->opts.drink_script_len;
+	*len = 0;
+	while (*len < DRINK_SCRIPT_MAX)
+	{
+		if (*val < '0' || *val > '9')
+			error("Syntax error : --drink-script expects masks like 3,5\n");
+		mask = 0;
+		while (*val >= '0' && *val <= '9' && mask <= INT_MAX)
+			mask = mask * 10 + (*val++ - '0');
+		if ((*val && *val != ',') || mask > INT_MAX)
+			error("Syntax error : --drink-script expects masks like 3,5\n");
+		table->opts.drink_script[(*len)++] = mask;
+		if (*val == '\0')
+			return ;
+		val++;
+	}
+	error("Syntax error : --drink-script expects 1 to 32 masks\n");
+}
+
+/**
+ * @brief Les masques de --drink-script ne peuvent viser que les 2R
+ * bouteilles reliees : un bit au-dela est une erreur, pas un bit ignore.
+ * 
+ * @param table Structure principale (drink_radius deja fixe)
+ */
+void	check_drink_script(t_table *table)
+{
+	long	i;
+
+	i = -1;
+	while (++i < table->opts.drink_script_len)
+		if (table->opts.drink_script[i] >> (2 * table->opts.drink_radius))
+			error("Syntax error : --drink-script masks must be below "
+				"2^(2R)\n");
+}
+
+/**
+ * @brief Coherence du mode buveurs : il faut 2R places distinctes, des
+ * masques sur 2R bits, et ni --elastic (anneau mouvant), ni --des ni
+ * --solve (modeles a deux fourchettes), ni --slack-priority (cession
+ * entre les deux fourchettes fixes) ne le connaissent.
+ * 
+ * @param table Structure principale
+ */
+void	check_drinking(t_table *table)
+{
+	if (table->opts.drink_script_len > 0 && !table->opts.drink_radius)
+		table->opts.drink_radius = 1;
+	if (!table->opts.drink_radius)
+		return ;
+	if (table->philo_nbr < 2 * table->opts.drink_radius)
+		error("Syntax error : --drinking=R needs at least 2R philosophers\n");
+	if (table->opts.elastic_period > 0 || table->opts.des_horizon > 0
+		|| table->opts.solve || table->opts.slack_priority)
+		error("Syntax error : --drinking excludes --elastic, --des, --solve "
+			"and --slack-priority\n");
+	check_drink_script(table);
+}
@@ -0,0 +1,76 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   options_handlers.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:15:12 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/19 17:48:06 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/* Un handler par option longue. val vaut "" pour "--nom" seul. */
+
+/**
+ * @brief --metrics[=NOM] : publie la page de stats en memoire partagee.
+ * 
+ * @param table Structure principale
+ * @param val Nom du segment shm (METRICS_DEFAULT si vide)
+ */
+void	opt_metrics(t_table *table, char *val)
+{
+	table->opts.metrics_name = METRICS_DEFAULT;
+	if (*val)
+		table->opts.metrics_name = val;
+}
+
+/**
+ * @brief --max-philos=N : nombre maximal de places a table (--elastic).
+ * 
+ * @param table Structure principale
+ * @param val Nombre de places
+ */
+void	opt_max_philos(t_table *table, char *val)
+{
+	table->opts.max_philos = ft_atol(val);
+}
+
+/**
+ * @brief --elastic=MS : un philo arrive ou part toutes les MS ms.
+ * 
+ * @param table Structure principale
+ * @param val Periode en millisecondes
+ */
+void	opt_elastic(t_table *table, char *val)
+{
+	table->opts.elastic_period = ft_atol(val);
+	if (table->opts.elastic_period <= 0)
+		error("Syntax error : --elastic expects a period in ms\n");
+}
+
+/**
+ * @brief --low-cpu : toutes les attentes bloquent au lieu de tourner.
+ * 
+ * @param table Structure principale
+ * @param val Ignore
+ */
+void	opt_low_cpu(t_table *table, char *val)
+{
+	(void)val;
+	table->opts.low_cpu = true;
+}
+
+/**
+ * @brief --cpu-report : affiche le cout CPU et la precision obtenue.
+ * 
+ * @param table Structure principale
+ * @param val Ignore
+ */
+void	opt_cpu_report(t_table *table, char *val)
+{
+	(void)val;
+	table->opts.cpu_report = true;
+}
@@ -0,0 +1,70 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   options_monitor.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 13:38:14 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/20 19:40:12 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "philo.h"
+
+/* Handlers des options qui changent la facon de detecter les deces ou
+de les eviter. */
+
+/**
+ * @brief --timerfd : une echeance timerfd par philo, le monitor attend
+ * dans epoll_wait au lieu de scanner toute la table.
+ * 
+ * @param table Structure principale
+ * @param val Ignore
+ */
+void	opt_timerfd(t_table *table, char *val)
+{
+	(void)val;
+	table->opts.timerfd = true;
+}
+
+/**
+ * @brief --slack : mesure la marge avant la mort a chaque repas et
+ * l'affiche en fin de simulation.
+ * 
+ * @param table Structure principale
+ * @param val Ignore
+ */
+void	opt_slack(t_table *table, char *val)
+{
+	(void)val;
+	table->opts.slack_report = true;
+}
+
+/**
+ * @brief --slack-priority : un philo a court de marge passe avant ses
+ * voisins sur les fourchettes disputees.
+ * 
+ * @param table Structure principale
+ * @param val Ignore
+ */
+void	opt_slack_priority(t_table *table, char *val)
+{
+	(void)val;
+	table->opts.slack_priority = true;
+}
+
+/**
+ * @brief --shards=K : K threads de scan sur des tranches de places
+ * contigues, coordonnes par le monitor. Sans effet avec --timerfd.
+ * 
+ * @param table Structure principale
+ * @param val Nombre de tranches
+ */
+void	opt_shards(t_table *table, char *val)
+{
+	table->opts.shards = ft_atol(val);
+	if (table->opts.shards <= 0)
+		error("Syntax error : --shards expects a shard count\n");
+}
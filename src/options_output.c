@@ -0,0 +1,66 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   options_output.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 18:40:15 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 14:44:51 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/* Handlers des options qui changent la facon d'ecrire les statuts. */
+
+/**
+ * @brief --fast-output : lignes pre-formatees, ecrites par writev.
+ * 
+ * @param table Structure principale
+ * @param val Ignore
+ */
+void	opt_fast_output(t_table *table, char *val)
+{
+	(void)val;
+	table->opts.fast_output = true;
+}
+
+/**
+ * @brief --output=FICHIER : sortie rapide dans un fichier mappe.
+ * 
+ * @param table Structure principale
+ * @param val Chemin du fichier
+ */
+void	opt_output(t_table *table, char *val)
+{
+	if (!*val)
+		error("Syntax error : --output expects a file name\n");
+	table->opts.fast_output = true;
+	table->opts.output_file = val;
+}
+
+/**
+ * @brief --trace=FICHIER : statuts en binaire compact (philo-trace).
+ * 
+ * @param table Structure principale
+ * @param val Chemin du fichier
+ */
+void	opt_trace(t_table *table, char *val)
+{
+	if (!*val)
+		error("Syntax error : --trace expects a file name\n");
+	table->opts.trace_file = val;
+}
+
+/**
+ * @brief Une seule sortie des statuts a la fois : --trace remplace
+ * l'affichage, il ne peut pas se combiner avec --fast-output ou --output.
+ * 
+ * @param table Structure principale
+ */
+void	check_output(t_table *table)
+{
+	if (table->opts.trace_file && table->opts.fast_output)
+		error("Syntax error : --trace excludes --fast-output and --output\n");
+}
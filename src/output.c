@@ -0,0 +1,144 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   output.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 18:10:37 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 10:44:51 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/**
+ * @brief Ecrit n en decimal, complete a 6 caracteres par des espaces
+ * (comme "%-6ld").
+ * 
+ * @param dst Destination (au moins 20 octets)
+ * @param n Nombre positif
+ * @return Nombre d'octets ecrits
+ */
+int	out_utoa(char *dst, long n)
+{
+	char	tmp[20];
+	int		len;
+	int		i;
+
+	len = 0;
+	tmp[len++] = '0' + n % 10;
+	while (n >= 10)
+	{
+		n /= 10;
+		tmp[len++] = '0' + n % 10;
+	}
+	i = -1;
+	while (++i < len)
+		dst[i] = tmp[len - 1 - i];
+	while (i < 6)
+		dst[i++] = ' ';
+	return (i);
+}
+
+/**
+ * @brief Place libre pour une ligne : dans le fichier mappe (fenetre
+ * deplacee si besoin), sinon dans le segment courant du tampon, vide
+ * par writev quand tous les segments sont pleins.
+ * 
+ * @param out Sortie rapide
+ * @return Adresse ou ecrire au plus OUT_LINE_MAX octets
+ */
+char	*out_reserve(t_output *out)
+{
+	if (out->map)
+	{
+		if (out->map_pos + OUT_LINE_MAX > OUT_MAP_SIZE)
+			out_map(out);
+		return (out->map + out->map_pos);
+	}
+	if (out->iov[out->chunk].iov_len + OUT_LINE_MAX > OUT_CHUNK
+		&& ++out->chunk == OUT_CHUNKS)
+		out_flush(out);
+	return ((char *)out->iov[out->chunk].iov_base
+		+ out->iov[out->chunk].iov_len);
+}
+
+/**
+ * @brief Ajoute la ligne d'un statut : l'horodatage, puis le suffixe
+ * pre-formate du philo. Appele sous write_lock.
+ * 
+ * @param table Structure principale
+ * @param philo Philosophe concerne
+ * @param status Statut a afficher
+ * @param elapsed Temps depuis le debut de la simulation (ms)
+ */
+void	out_status(t_table *table, t_philo *philo, t_philo_status status,
+			long elapsed)
+{
+	t_output	*out;
+	char		*line;
+	long		slot;
+	int			len;
+
+	out = &table->output;
+	line = out_reserve(out);
+	slot = (philo->id - 1) * (DIED + 1) + status;
+	len = out_utoa(line, elapsed);
+	memcpy(line + len, out->suffix + slot * OUT_SUFFIX, out->suffix_len[slot]);
+	len += out->suffix_len[slot];
+	if (out->map)
+		out->map_pos += len;
+	else
+		out->iov[out->chunk].iov_len += len;
+	if (status == DIED)
+		out_flush(out);
+}
+
+/**
+ * @brief Envoie les segments remplis du tampon en un seul writev, puis
+ * les vide. Rien a faire pour un fichier mappe.
+ * 
+ * @param out Sortie rapide
+ */
+void	out_flush(t_output *out)
+{
+	int	i;
+
+	if (out->map)
+		return ;
+	out_writev(out->fd, out->iov, out->chunk + (out->chunk < OUT_CHUNKS));
+	out->chunk = 0;
+	i = -1;
+	while (++i < OUT_CHUNKS)
+	{
+		out->iov[i].iov_base = out->buf + i * OUT_CHUNK;
+		out->iov[i].iov_len = 0;
+	}
+}
+
+/**
+ * @brief Vide le tampon toutes les OUT_FLUSH_MS au plus, pour que les
+ * lignes ne restent pas en attente jusqu'a ce qu'il soit plein. Appele
+ * par la boucle du monitor, qui prend write_lock. Rien a faire pour un
+ * fichier mappe.
+ * 
+ * @param table Structure principale
+ */
+void	out_tick(t_table *table)
+{
+	t_output	*out;
+	long		now;
+
+	out = &table->output;
+	if (!table->opts.fast_output || table->opts.output_file)
+		return ;
+	now = get_time(MILLISECOND);
+	if (now - out->flushed_at < OUT_FLUSH_MS)
+		return ;
+	safe_handle_mutex(&table->write_lock, LOCK);
+	if (out->chunk || out->iov[0].iov_len)
+		out_flush(out);
+	safe_handle_mutex(&table->write_lock, UNLOCK);
+	out->flushed_at = now;
+}
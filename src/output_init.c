@@ -0,0 +1,147 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   output_init.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 18:26:52 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/19 18:26:52 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+#include <sys/mman.h>
+#include <fcntl.h>
+
+/**
+ * @brief writev complet : recommence apres une ecriture partielle.
+ * 
+ * @param fd Descripteur de sortie
+ * @param iov Segments a ecrire (modifies)
+ * @param count Nombre de segments
+ */
+void	out_writev(int fd, struct iovec *iov, int count)
+{
+	ssize_t	n;
+
+	while (count > 0)
+	{
+		n = writev(fd, iov, count);
+		if (n < 0 && errno != EINTR)
+			error("Philo : writev failed.\n");
+		while (count > 0 && n >= 0 && (size_t)n >= iov->iov_len)
+		{
+			n -= iov->iov_len;
+			iov++;
+			count--;
+		}
+		if (count > 0 && n > 0)
+		{
+			iov->iov_base = (char *)iov->iov_base + n;
+			iov->iov_len -= n;
+		}
+	}
+}
+
+/**
+ * @brief Pre-formate " <id> <action>\n" pour chaque place et chaque
+ * statut : out_status n'a plus qu'a copier le suffixe.
+ * 
+ * @param table Structure principale
+ */
+void	out_render(t_table *table)
+{
+	static const char	*actions[] = {"is eating", "is sleeping",
+		"is thinking", "has taken a fork", "has taken a fork", "died"};
+	t_output			*out;
+	long				slot;
+
+	out = &table->output;
+	out->suffix = safe_malloc(table->philo_cap * (DIED + 1) * OUT_SUFFIX);
+	out->suffix_len = safe_malloc(table->philo_cap * (DIED + 1));
+	slot = -1;
+	while (++slot < table->philo_cap * (DIED + 1))
+		out->suffix_len[slot] = snprintf(out->suffix + slot * OUT_SUFFIX,
+				OUT_SUFFIX, " %ld %s\n", slot / (DIED + 1) + 1,
+				actions[slot % (DIED + 1)]);
+}
+
+/**
+ * @brief Ouvre la sortie rapide : tampon de OUT_CHUNKS segments vide
+ * par writev sur stdout, ou fenetre mmap sur le fichier --output.
+ * 
+ * @param table Structure principale
+ */
+void	out_init(t_table *table)
+{
+	t_output	*out;
+
+	out = &table->output;
+	memset(out, 0, sizeof(t_output));
+	out->fd = STDOUT_FILENO;
+	if (!table->opts.fast_output)
+		return ;
+	out_render(table);
+	if (table->opts.output_file)
+	{
+		out->fd = open(table->opts.output_file, O_RDWR | O_CREAT | O_TRUNC,
+				0644);
+		if (out->fd < 0)
+			error("Philo : cannot open --output file.\n");
+		out_map(out);
+		return ;
+	}
+	out->buf = safe_malloc(OUT_CHUNK * OUT_CHUNKS);
+	out_flush(out);
+}
+
+/**
+ * @brief Avance la fenetre mmap sur le fichier : la partie deja ecrite
+ * est demappee et le fichier agrandi de OUT_MAP_SIZE.
+ * 
+ * @param out Sortie rapide (mode fichier)
+ */
+void	out_map(t_output *out)
+{
+	size_t	page;
+
+	page = sysconf(_SC_PAGESIZE);
+	if (out->map)
+		munmap(out->map, OUT_MAP_SIZE);
+	out->map_base += out->map_pos & ~(page - 1);
+	out->map_pos &= page - 1;
+	if (ftruncate(out->fd, out->map_base + OUT_MAP_SIZE) < 0)
+		error("Philo : cannot grow --output file.\n");
+	out->map = mmap(NULL, OUT_MAP_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED,
+			out->fd, out->map_base);
+	if (out->map == MAP_FAILED)
+		error("Philo : --output mmap failed.\n");
+}
+
+/**
+ * @brief Vide la sortie rapide et libere ses ressources. Le fichier
+ * --output est ramene a la taille reellement ecrite.
+ * 
+ * @param table Structure principale
+ */
+void	out_destroy(t_table *table)
+{
+	t_output	*out;
+
+	out = &table->output;
+	if (!table->opts.fast_output)
+		return ;
+	if (out->map)
+	{
+		munmap(out->map, OUT_MAP_SIZE);
+		if (ftruncate(out->fd, out->map_base + out->map_pos) < 0)
+			error("Philo : cannot truncate --output file.\n");
+		close(out->fd);
+	}
+	else
+		out_flush(out);
+	free(out->buf);
+	free(out->suffix);
+	free(out->suffix_len);
+}
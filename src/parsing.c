@@ -6,7 +6,7 @@
 /*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/22 18:00:05 by marguima          #+#    #+#             */
-/*   Updated: 2026/01/25 14:21:58 by marguima         ###   ########.fr       */
+/*   Updated: 2026/10/19 14:31:40 by marguima         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -70,7 +70,7 @@ long	ft_atol(char *nptr)
 
 /**
  * @brief Initialise les arguments dans la structure t_table.
- * Check les erreurs de syntaxe.
+ * Check les erreurs de syntaxe, puis la coherence des options.
  * 
  * @param table Structure de donnee initialisee dans le main
  * @param av Arguments passes au programme
@@ -90,4 +90,5 @@ void	parse_input(t_table *table, char **av)
 		table->nbr_limit_meals = ft_atol(av[5]);
 	else
 		table->nbr_limit_meals = -1;
+	check_options(table);
 }
@@ -0,0 +1,159 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pool.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 11:16:45 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/20 16:12:09 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "philo.h"
+
+/* Pool de threads persistant de libphilo : le monitor et un thread par
+philosophe sont crees une fois puis parques entre deux runs. Un run
+incremente generation et reveille ses philo_nbr + 1 slots d'un seul
+broadcast sur pool->start. Les slots en trop attendent sur pool->idle :
+ils ne sont reveilles que si un run en demande plus que le precedent,
+sinon chaque depart reveillerait tout le pool. */
+
+/**
+ * @brief Travail d'un slot pour un run : monitor pour le slot 0, la
+ * routine du philosophe index - 1 pour les autres.
+ * 
+ * @param slot Slot reveille
+ */
+void	pool_job(t_pool_slot *slot)
+{
+	t_table	*table;
+
+	table = slot->pool->table;
+	if (slot->index == 0)
+		monitor(table);
+	else if (table->philo_nbr == 1)
+		alone_philo(table->philos);
+	else
+		dinner_simulation(table->philos + slot->index - 1);
+}
+
+/**
+ * @brief Parque le slot jusqu'a une nouvelle generation qui le
+ * concerne (index < active), ou jusqu'a la destruction du pool.
+ * 
+ * @param slot Slot a parquer
+ * @return false si le pool est detruit
+ */
+bool	pool_park(t_pool_slot *slot)
+{
+	t_pool	*pool;
+	bool	run;
+
+	pool = slot->pool;
+	safe_handle_mutex(&pool->lock, LOCK);
+	while (!pool->quit && (pool->generation == slot->seen
+			|| slot->index >= pool->active))
+	{
+		slot->seen = pool->generation;
+		if (slot->index >= pool->active)
+			pthread_cond_wait(&pool->idle, &pool->lock);
+		else
+			pthread_cond_wait(&pool->start, &pool->lock);
+	}
+	slot->seen = pool->generation;
+	run = !pool->quit;
+	safe_handle_mutex(&pool->lock, UNLOCK);
+	return (run);
+}
+
+/**
+ * @brief Routine d'un thread du pool : attend, travaille, se signale
+ * revenu, et recommence jusqu'a pool_destroy.
+ * 
+ * @param data Pointeur vers le t_pool_slot du thread
+ * @return NULL
+ */
+void	*pool_worker(void *data)
+{
+	t_pool_slot	*slot;
+
+	slot = (t_pool_slot *)data;
+	while (pool_park(slot))
+	{
+		pool_job(slot);
+		safe_handle_mutex(&slot->pool->lock, LOCK);
+		slot->pool->done++;
+		pthread_cond_signal(&slot->pool->finished);
+		safe_handle_mutex(&slot->pool->lock, UNLOCK);
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Porte le pool a au moins size threads. Les threads existants
+ * restent parques ; le pool ne retrecit jamais.
+ * 
+ * @param pool Pool (entre deux runs)
+ * @param size Nombre de slots voulus (philo_nbr + 1)
+ * @return PHILO_OK, PHILO_ENOMEM ou PHILO_ETHREAD
+ */
+t_philo_err	pool_grow(t_pool *pool, long size)
+{
+	t_pool_slot	**slots;
+	t_pool_slot	*slot;
+
+	if (size <= pool->size)
+		return (PHILO_OK);
+	slots = realloc(pool->slots, sizeof(t_pool_slot *) * size);
+	if (!slots)
+		return (PHILO_ENOMEM);
+	pool->slots = slots;
+	while (pool->size < size)
+	{
+		slot = calloc(1, sizeof(t_pool_slot));
+		if (!slot)
+			return (PHILO_ENOMEM);
+		slot->pool = pool;
+		slot->index = pool->size;
+		slot->seen = pool->generation;
+		if (pthread_create(&slot->thread, NULL, pool_worker, slot))
+		{
+			free(slot);
+			return (PHILO_ETHREAD);
+		}
+		pool->slots[pool->size++] = slot;
+	}
+	return (PHILO_OK);
+}
+
+/**
+ * @brief Reveille tout le pool pour qu'il se termine, joint chaque
+ * thread et libere les slots.
+ * 
+ * @param pool Pool (entre deux runs)
+ */
+void	pool_destroy(t_pool *pool)
+{
+	long	i;
+
+	safe_handle_mutex(&pool->lock, LOCK);
+	pool->quit = true;
+	pthread_cond_broadcast(&pool->start);
+	pthread_cond_broadcast(&pool->idle);
+	safe_handle_mutex(&pool->lock, UNLOCK);
+	i = -1;
+	while (pool->size > ++i)
+	{
+		safe_thread_handle(&pool->slots[i]->thread, NULL, NULL, JOIN);
+		free(pool->slots[i]);
+	}
+	free(pool->slots);
+	pool->slots = NULL;
+	pool->size = 0;
+	safe_handle_mutex(&pool->lock, DESTROY);
+	pthread_cond_destroy(&pool->start);
+	pthread_cond_destroy(&pool->idle);
+	pthread_cond_destroy(&pool->finished);
+}
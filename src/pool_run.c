@@ -0,0 +1,90 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pool_run.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 11:31:07 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 11:02:14 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "philo.h"
+
+/**
+ * @brief Prepare un pool vide (aucun thread avant le premier pool_grow).
+ * 
+ * @param pool Pool a initialiser
+ * @param table Table sur laquelle les slots travailleront
+ * @return PHILO_OK ou PHILO_ENOMEM (rien ne reste initialise)
+ */
+t_philo_err	pool_init(t_pool *pool, t_table *table)
+{
+	memset(pool, 0, sizeof(t_pool));
+	pool->table = table;
+	if (pthread_mutex_init(&pool->lock, NULL))
+		return (PHILO_ENOMEM);
+	if (pthread_cond_init(&pool->start, NULL) == 0)
+	{
+		if (pthread_cond_init(&pool->idle, NULL) == 0)
+		{
+			if (pthread_cond_init(&pool->finished, NULL) == 0)
+				return (PHILO_OK);
+			pthread_cond_destroy(&pool->idle);
+		}
+		pthread_cond_destroy(&pool->start);
+	}
+	pthread_mutex_destroy(&pool->lock);
+	return (PHILO_ENOMEM);
+}
+
+/**
+ * @brief Attend que count slots actifs soient revenus au parking.
+ * 
+ * @param pool Pool en cours de run
+ * @param count Nombre de retours attendus
+ */
+void	pool_wait(t_pool *pool, long count)
+{
+	safe_handle_mutex(&pool->lock, LOCK);
+	while (pool->done < count)
+		pthread_cond_wait(&pool->finished, &pool->lock);
+	safe_handle_mutex(&pool->lock, UNLOCK);
+}
+
+/**
+ * @brief Equivalent de dinner_start sur le pool : libere les
+ * philo_nbr + 1 premiers slots d'un seul broadcast, donne le depart,
+ * puis attend les philosophes avant d'arreter le monitor.
+ * 
+ * @details Le monitor ne rend la main qu'une fois end_simulation pose.
+ * Quand done atteint philo_nbr, soit tous les philos sont revenus, soit
+ * le monitor est deja sorti (deces) : dans les deux cas on peut poser
+ * end_simulation puis attendre les philo_nbr + 1 retours.
+ * 
+ * @param pool Pool d'au moins philo_nbr + 1 slots (pool_grow)
+ * @param table Table remise a zero (data_reset)
+ */
+void	pool_run(t_pool *pool, t_table *table)
+{
+	if (table->nbr_limit_meals == 0)
+		return ;
+	safe_handle_mutex(&pool->lock, LOCK);
+	if (table->philo_nbr + 1 > pool->active)
+		pthread_cond_broadcast(&pool->idle);
+	pool->active = table->philo_nbr + 1;
+	pool->done = 0;
+	pool->generation++;
+	pthread_cond_broadcast(&pool->start);
+	safe_handle_mutex(&pool->lock, UNLOCK);
+	table->start_simulation = get_time(MILLISECOND);
+	metrics_start(table);
+	PROBE1(barrier_release, table->philo_nbr);
+	wake_all(table, &table->all_ready);
+	pool_wait(pool, table->philo_nbr);
+	wake_all(table, &table->end_simulation);
+	pool_wait(pool, table->philo_nbr + 1);
+	metrics_stop(table, NULL);
+}
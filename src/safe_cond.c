@@ -0,0 +1,54 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   safe_cond.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/21 14:02:10 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 14:02:10 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/**
+ * @brief Gère les erreurs des opérations sur les variables de condition.
+ * 
+ * Même principe que handle_mutex_error : affiche un message selon le
+ * code errno et exit le programme si une erreur est détectée.
+ * 
+ * @param status Code de retour de la fonction pthread_cond
+ * @param fcode Code de l'opération (INIT/DESTROY)
+ */
+void	handle_cond_error(int status, t_fcode fcode)
+{
+	if (status == 0)
+		return ;
+	if ((status == EAGAIN || status == ENOMEM) && fcode == INIT)
+		error("The system lacked the necessary resources to initialize "
+			"another condition variable.\n");
+	else if (status == EBUSY)
+		error("The condition variable is in use by another thread.\n");
+	else
+		error("The value specified by cond or attr is invalid.\n");
+}
+
+/**
+ * @brief Wrapper sécurisé pour l'initialisation et la destruction des
+ * variables de condition.
+ * 
+ * @param cond Pointeur vers la variable de condition
+ * @param fcode Opération à effectuer (INIT/DESTROY)
+ * @return NULL
+ */
+void	*safe_handle_cond(t_cond *cond, t_fcode fcode)
+{
+	if (fcode == INIT)
+		handle_cond_error(pthread_cond_init(cond, NULL), fcode);
+	else if (fcode == DESTROY)
+		handle_cond_error(pthread_cond_destroy(cond), fcode);
+	else
+		error("Wrong cond code\n");
+	return (NULL);
+}
@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   seqlock.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:20:41 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/19 09:20:41 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/* Seqlock minimal : un seul ecrivain par compteur, lecteurs sans verrou.
+Compteur impair = ecriture en cours. Les donnees protegees sont des
+atomiques lues/ecrites en memory_order_relaxed, les fences font le reste. */
+
+/**
+ * @brief Ouvre une section d'ecriture (le compteur devient impair).
+ * 
+ * @param seq Compteur de sequence du bloc a modifier
+ */
+void	seq_write_begin(t_seq *seq)
+{
+	unsigned int	s;
+
+	s = atomic_load_explicit(seq, memory_order_relaxed);
+	atomic_store_explicit(seq, s + 1, memory_order_relaxed);
+	atomic_thread_fence(memory_order_release);
+}
+
+/**
+ * @brief Ferme la section d'ecriture (le compteur redevient pair).
+ * 
+ * @param seq Compteur de sequence du bloc modifie
+ */
+void	seq_write_end(t_seq *seq)
+{
+	unsigned int	s;
+
+	s = atomic_load_explicit(seq, memory_order_relaxed);
+	atomic_store_explicit(seq, s + 1, memory_order_release);
+}
+
+/**
+ * @brief Attend une valeur paire du compteur avant une lecture.
+ * 
+ * Ne bloque jamais l'ecrivain : c'est le lecteur qui reessaie.
+ * 
+ * @param seq Compteur de sequence du bloc a lire
+ * @return La valeur a repasser a seq_read_retry
+ */
+unsigned int	seq_read_begin(t_seq *seq)
+{
+	unsigned int	s;
+
+	s = atomic_load_explicit(seq, memory_order_acquire);
+	while (s & 1)
+		s = atomic_load_explicit(seq, memory_order_acquire);
+	return (s);
+}
+
+/**
+ * @brief Verifie qu'aucune ecriture n'a eu lieu pendant la lecture.
+ * 
+ * @param seq Compteur de sequence du bloc lu
+ * @param start Valeur retournee par seq_read_begin
+ * @return true si la copie est incoherente et doit etre refaite
+ */
+bool	seq_read_retry(t_seq *seq, unsigned int start)
+{
+	atomic_thread_fence(memory_order_acquire);
+	return (atomic_load_explicit(seq, memory_order_relaxed) != start);
+}
@@ -0,0 +1,135 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   shard.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 19:12:03 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 13:20:05 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "philo.h"
+
+/* --shards=K : la table est coupee en K tranches de places contigues,
+chacune scannee par son propre thread. Les tranches ne touchent ni a
+end_simulation ni a la sortie : elles signalent le premier deces vu au
+monitor, qui devient coordinateur et ecrit seul la ligne "died". Les
+bornes sont recalculees a chaque passage (--elastic). */
+
+/**
+ * @brief Signale au coordinateur le deces de la place seat. Seul le
+ * premier signalement compte.
+ * 
+ * @param group Tranches du run
+ * @param seat Index de la place
+ */
+void	shard_post(t_shards *group, long seat)
+{
+	safe_handle_mutex(&group->lock, LOCK);
+	if (group->dead == 0)
+		group->dead = seat + 1;
+	pthread_cond_signal(&group->posted);
+	safe_handle_mutex(&group->lock, UNLOCK);
+}
+
+/**
+ * @brief Un passage sur les places [lo, hi) : une lecture sans verrou
+ * de la view de chaque place (sa version la plus recente) donne a la
+ * fois le soupcon de deces et l'echeance. Seuls les suspects sont
+ * relus sous mutex (philo_died), comme dans monitor_scan.
+ * 
+ * @param deadline Premiere echeance de la tranche (us), en sortie
+ * @return true si un deces a ete vu et signale
+ */
+bool	shard_pass(t_shard *shard, long lo, long hi, long *deadline)
+{
+	t_table			*table;
+	t_philo_snap	copy;
+	long			now;
+
+	table = shard->group->table;
+	*deadline = LONG_MAX;
+	now = get_time(MILLISECOND);
+	while (lo < hi)
+	{
+		snapshot_read_philo(table->philos + lo, LONG_MAX, &copy);
+		if (monitor_suspect(table, &copy, now)
+			&& !simulation_finished(table)
+			&& philo_died(table->philos + lo))
+		{
+			shard_post(shard->group, lo);
+			return (true);
+		}
+		if (snap_deadline(table, &copy) < *deadline)
+			*deadline = snap_deadline(table, &copy);
+		lo++;
+	}
+	return (false);
+}
+
+/**
+ * @brief Thread d'une tranche : scanne ses places jusqu'a la fin de la
+ * simulation ou au premier deces, et dort entre deux passages jusqu'a
+ * la premiere echeance de sa tranche, avec ou sans --low-cpu : K
+ * threads qui tournent se partageraient les coeurs au lieu de scanner.
+ * 
+ * @param data Pointeur vers le t_shard
+ * @return NULL
+ */
+void	*shard_scan(void *data)
+{
+	t_shard	*shard;
+	t_table	*table;
+	long	n;
+	long	lo;
+	long	hi;
+	long	deadline;
+
+	shard = (t_shard *)data;
+	table = shard->group->table;
+	while (!simulation_finished(table))
+	{
+		n = atomic_load(&table->ring_size);
+		lo = n * shard->index / shard->group->count;
+		hi = n * (shard->index + 1) / shard->group->count;
+		if (shard_pass(shard, lo, hi, &deadline))
+			break ;
+		sleep_until(table, deadline);
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Coordinateur (thread monitor) : lance les tranches, attend un
+ * signalement ou la fin de la simulation, ecrit la ligne "died" puis
+ * rejoint les tranches. L'attente est bornee a 1 ms pour voir passer
+ * end_simulation quand tous sont rassasies et vider la sortie rapide
+ * (out_tick).
+ * 
+ * @param table Structure principale
+ */
+void	shard_coordinate(t_table *table)
+{
+	t_shards	group;
+	long		i;
+
+	shard_start(table, &group);
+	safe_handle_mutex(&group.lock, LOCK);
+	while (group.dead == 0 && !simulation_finished(table))
+	{
+		shard_timedwait(&group, 1000);
+		out_tick(table);
+	}
+	safe_handle_mutex(&group.lock, UNLOCK);
+	if (group.dead)
+		monitor_report(table, table->philos + group.dead - 1);
+	i = -1;
+	while (++i < group.count)
+		safe_thread_handle(&group.slots[i].thread, NULL, NULL, JOIN);
+	pthread_cond_destroy(&group.posted);
+	safe_handle_mutex(&group.lock, DESTROY);
+	free(group.slots);
+}
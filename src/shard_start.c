@@ -0,0 +1,61 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   shard_start.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 19:15:27 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/20 19:15:27 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "philo.h"
+
+/**
+ * @brief Prepare les tranches d'un run et lance leurs threads. Il n'y a
+ * jamais plus de tranches que de places.
+ * 
+ * @param table Structure principale
+ * @param group Tranches du run (sur la pile du coordinateur)
+ */
+void	shard_start(t_table *table, t_shards *group)
+{
+	long	i;
+
+	group->table = table;
+	group->dead = 0;
+	group->count = table->opts.shards;
+	if (group->count > table->philo_nbr)
+		group->count = table->philo_nbr;
+	safe_handle_mutex(&group->lock, INIT);
+	pthread_cond_init(&group->posted, NULL);
+	group->slots = safe_malloc(sizeof(t_shard) * group->count);
+	i = -1;
+	while (++i < group->count)
+	{
+		group->slots[i].group = group;
+		group->slots[i].index = i;
+		safe_thread_handle(&group->slots[i].thread, shard_scan,
+			group->slots + i, CREATE);
+	}
+}
+
+/**
+ * @brief Attend un signalement au plus us microsecondes (group->lock
+ * tenu par l'appelant).
+ * 
+ * @param group Tranches du run
+ * @param us Delai maximal
+ */
+void	shard_timedwait(t_shards *group, long us)
+{
+	struct timespec	ts;
+	long			deadline;
+
+	deadline = get_time(MICROSECOND) + us;
+	ts.tv_sec = deadline / 1000000;
+	ts.tv_nsec = deadline % 1000000 * 1000;
+	pthread_cond_timedwait(&group->posted, &group->lock, &ts);
+}
@@ -0,0 +1,158 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   slack.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 17:05:44 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 14:22:40 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "philo.h"
+
+/* Marge avant la mort (slack) : time_to_die - (now - last_meal_time), ce
+qu'il restait a un philo quand il a enfin mange. --slack la mesure a
+chaque repas. Avec --slack-priority, un philo dont la marge passe sous
+time_to_eat pose son echeance sur ses deux fourchettes ; un voisin plus a
+l'aise qui s'apprete a les reprendre lui cede la place tant qu'il ne
+devient pas lui-meme urgent, ce qui borne son attente. */
+
+/**
+ * @brief Pose l'echeance deadline sur fork, sauf si un voisin plus
+ * urgent y est deja.
+ * 
+ * @param fork Fourchette convoitee
+ * @param deadline Echeance du philo urgent (ms)
+ */
+void	slack_post(t_fork *fork, long deadline)
+{
+	long	cur;
+
+	cur = atomic_load(&fork->urgent);
+	while ((cur == 0 || deadline < cur)
+		&& !atomic_compare_exchange_weak(&fork->urgent, &cur, deadline))
+		;
+}
+
+/**
+ * @brief Vrai si un voisin plus urgent que deadline attend une de nos
+ * fourchettes.
+ */
+bool	slack_waits(t_philo *philo, long deadline)
+{
+	long	first;
+	long	second;
+
+	first = atomic_load(&philo->first_fork->urgent);
+	second = atomic_load(&philo->second_fork->urgent);
+	return ((first && first < deadline) || (second && second < deadline));
+}
+
+/**
+ * @brief Enregistre la marge du repas qui commence (avant la mise a
+ * jour de last_meal_time) : minimum, histogramme commun de la table et
+ * droite des moindres carres pour la tendance. Le premier repas, compte
+ * depuis le depart, reste hors de la droite.
+ * 
+ * @param philo Philosophe qui commence a manger
+ * @param now Debut du repas (ms)
+ */
+void	slack_record(t_philo *philo, long now)
+{
+	t_slack	*s;
+	long	left;
+	long	b;
+
+	if (!philo->table->opts.slack_report)
+		return ;
+	s = &philo->slack;
+	left = philo->table->time_to_die / MS_TO_US - (now - philo->last_meal_time);
+	if (s->count == 0 || left < s->min)
+		s->min = left;
+	if (s->count++ > 0)
+	{
+		s->sx += s->count;
+		s->sy += left;
+		s->sxy += (double)s->count * left;
+		s->sxx += (double)s->count * s->count;
+	}
+	b = left / philo->table->slack_width;
+	if (b < 0)
+		b = 0;
+	if (b >= SLACK_BUCKETS)
+		b = SLACK_BUCKETS - 1;
+	atomic_fetch_add_explicit(&philo->table->slack_hist[b], 1,
+		memory_order_relaxed);
+}
+
+/**
+ * @brief --slack-priority, avant de prendre les fourchettes : cede la
+ * place aux voisins plus urgents, puis, si la marge est passee sous
+ * time_to_eat, signale sa propre urgence sur ses deux fourchettes.
+ * 
+ * L'attente bloque sur slack_cond (diffusee par slack_clear et a la fin
+ * de la simulation), au plus jusqu'a ce que la marge passe sous
+ * time_to_eat : slack_waits est relu sous table_mutex, un slack_clear ne
+ * peut pas se perdre entre le test et l'attente. Une condvar a part
+ * evite de reveiller a chaque urgence levee tous les philos qui dorment
+ * sur table_cond (--low-cpu).
+ * 
+ * @param philo Philosophe qui veut manger
+ */
+void	slack_yield(t_philo *philo)
+{
+	t_table			*table;
+	struct timespec	ts;
+	long			deadline;
+	long			eat;
+
+	table = philo->table;
+	if (!table->opts.slack_priority)
+		return ;
+	deadline = philo->last_meal_time + table->time_to_die / MS_TO_US;
+	eat = table->time_to_eat / MS_TO_US;
+	ts.tv_sec = (deadline - eat + 1) / 1000;
+	ts.tv_nsec = (deadline - eat + 1) % 1000 * 1000000;
+	safe_handle_mutex(&table->table_mutex, LOCK);
+	while (deadline - get_time(MILLISECOND) >= eat
+		&& slack_waits(philo, deadline) && !table->end_simulation)
+		if (pthread_cond_timedwait(&table->slack_cond, &table->table_mutex,
+				&ts) == ETIMEDOUT)
+			break ;
+	safe_handle_mutex(&table->table_mutex, UNLOCK);
+	if (deadline - get_time(MILLISECOND) >= eat)
+		return ;
+	slack_post(philo->first_fork, deadline);
+	slack_post(philo->second_fork, deadline);
+}
+
+/**
+ * @brief Retire l'urgence posee par slack_yield une fois les deux
+ * fourchettes obtenues (avant la mise a jour de last_meal_time), et
+ * reveille les voisins qui lui cedaient la place.
+ * 
+ * @param philo Philosophe qui tient ses deux fourchettes
+ */
+void	slack_clear(t_philo *philo)
+{
+	long	deadline;
+	bool	cleared;
+
+	if (!philo->table->opts.slack_priority)
+		return ;
+	deadline = philo->last_meal_time + philo->table->time_to_die / MS_TO_US;
+	cleared = atomic_compare_exchange_strong(&philo->first_fork->urgent,
+			&deadline, 0);
+	deadline = philo->last_meal_time + philo->table->time_to_die / MS_TO_US;
+	if (atomic_compare_exchange_strong(&philo->second_fork->urgent,
+			&deadline, 0))
+		cleared = true;
+	if (!cleared)
+		return ;
+	safe_handle_mutex(&philo->table->table_mutex, LOCK);
+	pthread_cond_broadcast(&philo->table->slack_cond);
+	safe_handle_mutex(&philo->table->table_mutex, UNLOCK);
+}
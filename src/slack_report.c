@@ -0,0 +1,135 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   slack_report.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 17:24:10 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 14:22:40 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "philo.h"
+
+/**
+ * @brief Remet a zero l'histogramme des marges et les urgences posees
+ * sur les fourchettes (debut de run).
+ * 
+ * @param table Structure principale
+ */
+void	slack_init(t_table *table)
+{
+	long	i;
+
+	table->slack_width = table->time_to_die / MS_TO_US / SLACK_BUCKETS + 1;
+	i = -1;
+	while (++i < SLACK_BUCKETS)
+		atomic_init(&table->slack_hist[i], 0);
+	i = -1;
+	while (++i < table->philo_cap)
+		atomic_init(&table->forks[i].urgent, 0);
+}
+
+/**
+ * @brief Marge (ms, borne basse de la tranche) sous laquelle tombent
+ * q pour mille des repas.
+ */
+long	slack_percentile(t_table *table, long total, long q)
+{
+	long	seen;
+	long	b;
+
+	seen = 0;
+	b = -1;
+	while (++b < SLACK_BUCKETS - 1)
+	{
+		seen += atomic_load(&table->slack_hist[b]);
+		if (seen * 1000 >= total * q)
+			break ;
+	}
+	return (b * table->slack_width);
+}
+
+/**
+ * @brief Pente de la marge d'un philo, en ms par repas (negative si
+ * elle fond au fil du diner).
+ */
+double	slack_trend(t_slack *s)
+{
+	double	den;
+	long	n;
+
+	n = s->count - 1;
+	den = n * s->sxx - s->sx * s->sx;
+	if (n < 3 || den == 0)
+		return (0);
+	return ((n * s->sxy - s->sx * s->sy) / den);
+}
+
+/**
+ * @brief Parcourt les philos assis : ext[0] recoit celui qui a eu la plus
+ * petite marge, ext[1] celui dont la marge fond le plus vite.
+ * 
+ * @param table Structure principale (threads joints)
+ * @param ext Pire marge et pire tendance
+ * @param avg Recoit la tendance moyenne (a 0 a l'appel)
+ * @return Nombre total de repas mesures
+ */
+long	slack_scan(t_table *table, t_philo **ext, double *avg)
+{
+	long	i;
+	long	total;
+	long	seated;
+	t_philo	*p;
+
+	total = 0;
+	seated = 0;
+	i = -1;
+	while (++i < table->philo_cap)
+	{
+		p = table->philos + i;
+		if (p->id && p->slack.count)
+		{
+			total += p->slack.count;
+			*avg += slack_trend(&p->slack);
+			seated++;
+			if (!ext[0] || p->slack.min < ext[0]->slack.min)
+				ext[0] = p;
+			if (!ext[1]
+				|| slack_trend(&p->slack) < slack_trend(&ext[1]->slack))
+				ext[1] = p;
+		}
+	}
+	*avg /= seated + !seated;
+	return (total);
+}
+
+/**
+ * @brief --slack : affiche sur stderr la plus petite marge, les
+ * percentiles sur tous les repas (1 % et mediane), et la tendance du
+ * pire philo.
+ * 
+ * @param table Structure principale (threads joints)
+ */
+void	slack_report(t_table *table)
+{
+	t_philo	*ext[2];
+	double	avg;
+	long	total;
+
+	ext[0] = NULL;
+	ext[1] = NULL;
+	avg = 0;
+	total = slack_scan(table, ext, &avg);
+	if (!total)
+		return ;
+	fprintf(stderr, "slack: %ld meals, min %ld ms (philo %d), p1 %ld ms, "
+		"p50 %ld ms\n", total, ext[0]->slack.min, ext[0]->id,
+		slack_percentile(table, total, 10),
+		slack_percentile(table, total, 500));
+	fprintf(stderr, "slack: trend %+.2f ms/meal at worst (philo %d), "
+		"%+.2f ms/meal on average\n", slack_trend(&ext[1]->slack), ext[1]->id,
+		avg);
+}
@@ -0,0 +1,159 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   snapshot.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:05:33 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 10:12:40 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/* Snapshots coherents de la table sans verrou.
+Chaque philo garde deux versions de son etat public (view), datees par
+une horloge logique globale (snap_epoch) lue DANS son seqlock. Seul le
+lecteur avance l'horloge, une fois par snapshot : il fixe T en
+l'incrementant, puis prend, pour chaque philo, la version la plus
+recente <= T. Toute ecriture commencee apres l'increment est datee
+T + 1 ou plus : le resultat est l'etat exact de la table a T. Les
+ecrivains ne font que lire la ligne de cache de snap_epoch ; entre deux
+versions de meme epoch, le compteur local seq departage. */
+
+/**
+ * @brief Ecrit une nouvelle version de l'etat public d'un philo.
+ * 
+ * Ecrase la version la plus ancienne, la plus recente reste lisible
+ * pour un snapshot deja commence. L'epoch est lue a l'interieur
+ * du seqlock : un lecteur qui l'a avancee au-dela voit aussi la
+ * section ouverte et attend qu'elle se ferme.
+ * 
+ * @param philo Philosophe (appele par son propre thread uniquement)
+ * @param state Etat a publier
+ * @param forks Fourchettes tenues (HOLD_FIRST | HOLD_SECOND). Leurs ids
+ * ne sont lus que si forks != 0 : le philo est alors dans eat() sous
+ * seat_lock et ses pointeurs ne peuvent pas changer (--elastic).
+ */
+void	view_write(t_philo *philo, t_philo_status state, int forks)
+{
+	t_view	*v;
+	int		first;
+	int		second;
+
+	first = -1;
+	second = -1;
+	if (forks)
+		first = philo->first_fork->fork_id;
+	if (forks)
+		second = philo->second_fork->fork_id;
+	v = &philo->view[1 - philo->view_cur];
+	seq_write_begin(&philo->view_seq);
+	atomic_store_explicit(&v->epoch, atomic_load(&philo->table->snap_epoch),
+		memory_order_relaxed);
+	atomic_store_explicit(&v->state, state, memory_order_relaxed);
+	atomic_store_explicit(&v->forks, forks, memory_order_relaxed);
+	atomic_store_explicit(&v->first_fork, first, memory_order_relaxed);
+	atomic_store_explicit(&v->second_fork, second, memory_order_relaxed);
+	atomic_store_explicit(&v->meals, philo->meals_counter,
+		memory_order_relaxed);
+	atomic_store_explicit(&v->last_meal, philo->last_meal_time,
+		memory_order_relaxed);
+	atomic_store_explicit(&v->seq, ++philo->view_count, memory_order_relaxed);
+	seq_write_end(&philo->view_seq);
+	philo->view_cur = 1 - philo->view_cur;
+}
+
+/**
+ * @brief Publie un changement de statut dans la view du philo.
+ * 
+ * Les fourchettes tenues se deduisent du statut. La liberation est
+ * publiee a part (snapshot_release_forks) AVANT les UNLOCK, pour
+ * qu'aucun snapshot ne montre deux voisins tenant la meme fourchette.
+ * 
+ * @param philo Philosophe (appele par son propre thread uniquement)
+ * @param status Nouveau statut
+ */
+void	snapshot_publish(t_philo *philo, t_philo_status status)
+{
+	int	forks;
+
+	forks = 0;
+	if (status == TAKE_FIRST_FORK)
+		forks = HOLD_FIRST;
+	else if (status == TAKE_SECOND_FORK || status == EATING)
+		forks = HOLD_FIRST | HOLD_SECOND;
+	view_write(philo, status, forks);
+}
+
+/**
+ * @brief Publie que le philo ne tient plus aucune fourchette.
+ * 
+ * @param philo Philosophe (appele par son propre thread uniquement)
+ */
+void	snapshot_release_forks(t_philo *philo)
+{
+	view_write(philo, atomic_load_explicit(
+			&philo->view[philo->view_cur].state, memory_order_relaxed), 0);
+}
+
+/**
+ * @brief Choisit la version la plus recente dont l'epoch est <= epoch
+ * (a epoch egale, celle dont le compteur local seq est le plus grand).
+ * 
+ * @param philo Philosophe a lire (sous seqlock cote appelant)
+ * @param epoch Epoch du snapshot
+ * @return La version choisie (epoch > epoch si aucune ne convient)
+ */
+t_view	*view_pick(t_philo *philo, long epoch)
+{
+	long	e0;
+	long	e1;
+	bool	newer0;
+
+	e0 = atomic_load_explicit(&philo->view[0].epoch, memory_order_relaxed);
+	e1 = atomic_load_explicit(&philo->view[1].epoch, memory_order_relaxed);
+	newer0 = atomic_load_explicit(&philo->view[0].seq, memory_order_relaxed)
+		> atomic_load_explicit(&philo->view[1].seq, memory_order_relaxed);
+	if (e0 <= epoch && (e1 > epoch || newer0))
+		return (&philo->view[0]);
+	return (&philo->view[1]);
+}
+
+/**
+ * @brief Copie la version d'un philo valable a l'epoch donnee.
+ * 
+ * @param philo Philosophe a lire
+ * @param epoch Epoch du snapshot
+ * @param out Copie privee
+ * @return false si les deux versions sont plus recentes que epoch
+ * (le philo a publie deux fois pendant la lecture)
+ */
+bool	snapshot_read_philo(t_philo *philo, long epoch, t_philo_snap *out)
+{
+	unsigned int	s;
+	t_view			*v;
+	long			e;
+	bool			retry;
+
+	retry = true;
+	while (retry)
+	{
+		s = seq_read_begin(&philo->view_seq);
+		v = view_pick(philo, epoch);
+		e = atomic_load_explicit(&v->epoch, memory_order_relaxed);
+		out->state = atomic_load_explicit(&v->state, memory_order_relaxed);
+		out->forks = atomic_load_explicit(&v->forks, memory_order_relaxed);
+		out->first_fork = atomic_load_explicit(&v->first_fork,
+				memory_order_relaxed);
+		out->second_fork = atomic_load_explicit(&v->second_fork,
+				memory_order_relaxed);
+		out->meals = atomic_load_explicit(&v->meals, memory_order_relaxed);
+		out->last_meal = atomic_load_explicit(&v->last_meal,
+				memory_order_relaxed);
+		retry = seq_read_retry(&philo->view_seq, s);
+	}
+	out->id = philo - philo->table->philos + 1;
+	return (e <= epoch);
+}
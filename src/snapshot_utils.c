@@ -0,0 +1,130 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   snapshot_utils.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:32:50 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 09:58:20 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/* Prise de snapshot et requetes sur un snapshot deja pris.
+Les requetes travaillent sur la copie privee : aucune ne touche aux
+mutex ni aux donnees partagees de la simulation. */
+
+/**
+ * @brief Alloue le tableau de copies pour philo_cap places.
+ * Le meme snapshot peut etre repris autant de fois que voulu.
+ * 
+ * @param table Pointeur vers la structure principale
+ * @param snap Snapshot a preparer
+ */
+void	snapshot_alloc(t_table *table, t_snapshot *snap)
+{
+	snap->philo_nbr = table->philo_nbr;
+	snap->philos = safe_malloc(sizeof(t_philo_snap) * table->philo_cap);
+	snap->epoch = 0;
+	snap->attempts = 0;
+}
+
+/**
+ * @brief Libere le tableau de copies d'un snapshot.
+ * 
+ * @param snap Snapshot alloue par snapshot_alloc
+ */
+void	snapshot_free(t_snapshot *snap)
+{
+	free(snap->philos);
+	snap->philos = NULL;
+}
+
+/**
+ * @brief Prend un snapshot coherent de tous les philosophes.
+ * 
+ * Un seul passage O(N) sans verrou, et une seule ecriture partagee
+ * (l'increment de snap_epoch). Recommence (au plus SNAP_RETRIES fois)
+ * uniquement si un philo a publie deux fois pendant le passage.
+ * 
+ * @param table Pointeur vers la structure principale
+ * @param snap Snapshot prealloue par snapshot_alloc
+ * @return true si le snapshot est coherent
+ */
+bool	snapshot_take(t_table *table, t_snapshot *snap)
+{
+	long	i;
+	bool	ok;
+
+	snap->attempts = 0;
+	ok = false;
+	while (!ok && snap->attempts++ < SNAP_RETRIES)
+	{
+		snap->philo_nbr = atomic_load(&table->ring_size);
+		snap->epoch = atomic_fetch_add(&table->snap_epoch, 1);
+		snap->taken_at = get_time(MILLISECOND);
+		ok = true;
+		i = -1;
+		while (ok && ++i < snap->philo_nbr)
+			ok = snapshot_read_philo(table->philos + i, snap->epoch,
+					snap->philos + i);
+	}
+	return (ok);
+}
+
+/**
+ * @brief Trouve le philosophe qui tient une fourchette dans le snapshot.
+ * 
+ * Seuls les deux voisins de la fourchette peuvent la tenir, mais on
+ * passe par first_fork/second_fork pour ne pas dupliquer la logique
+ * d'assign_fork.
+ * 
+ * @param snap Snapshot coherent
+ * @param fork_id Identifiant de la fourchette (index dans table->forks)
+ * @return L'id du philosophe qui la tient, 0 si elle est libre
+ */
+int	snapshot_fork_holder(t_snapshot *snap, int fork_id)
+{
+	long			i;
+	t_philo_snap	*p;
+
+	i = -1;
+	while (++i < snap->philo_nbr)
+	{
+		p = snap->philos + i;
+		if ((p->forks & HOLD_FIRST) && p->first_fork == fork_id)
+			return (p->id);
+		if ((p->forks & HOLD_SECOND) && p->second_fork == fork_id)
+			return (p->id);
+	}
+	return (0);
+}
+
+/**
+ * @brief Marge minimale avant la mort parmi les philos non rassasies.
+ * 
+ * @param table Pointeur vers la structure principale (time_to_die)
+ * @param snap Snapshot coherent
+ * @return La plus petite marge en ms (LONG_MAX si tous sont rassasies)
+ */
+long	snapshot_min_slack(t_table *table, t_snapshot *snap)
+{
+	long			i;
+	long			slack;
+	long			min;
+	t_philo_snap	*p;
+
+	min = LONG_MAX;
+	i = -1;
+	while (++i < snap->philo_nbr)
+	{
+		p = snap->philos + i;
+		slack = table->time_to_die / 1e3 - (snap->taken_at - p->last_meal);
+		if (slack < min && (table->nbr_limit_meals <= 0
+				|| p->meals < table->nbr_limit_meals))
+			min = slack;
+	}
+	return (min);
+}
@@ -0,0 +1,111 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   solve.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 16:20:41 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 10:20:05 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/* Solveur analytique (--solve). Avec la strategie de dinner_simulation
+(ids pairs d'abord, reflexion de time_to_eat / 2 si le nombre est impair),
+le diner devient periodique :
+- nombre pair : deux groupes alternent, un philo mange toutes les
+  max(2 * eat, eat + sleep) ms ;
+- nombre impair : trois creneaux, un philo mange toutes les
+  max(3 * eat, eat + sleep + eat / 2) ms.
+Un philo meurt si cette periode depasse time_to_die, a time_to_die + 1
+(le premier ecart trop long commence a 0). */
+
+/**
+ * @brief Plus petit time_to_die (ms) pour lequel personne ne meurt.
+ * 
+ * @param table Arguments lus par parse_input
+ * @return Periode entre deux repas d'un meme philo (ms)
+ */
+long	solve_needed(t_table *table)
+{
+	long	eat;
+	long	sleep;
+	long	needed;
+
+	eat = table->time_to_eat / 1e3;
+	sleep = table->time_to_sleep / 1e3;
+	if (table->philo_nbr % 2 == 0)
+	{
+		needed = eat + sleep;
+		if (2 * eat > needed)
+			needed = 2 * eat;
+		return (needed);
+	}
+	needed = eat + sleep + eat / 2;
+	if (3 * eat > needed)
+		needed = 3 * eat;
+	return (needed);
+}
+
+/**
+ * @brief Classe le scenario sans le simuler.
+ * 
+ * Avec nombre_de_repas = 0, le diner s'arrete avant de commencer
+ * (dinner_start) : personne ne meurt, meme seul a table.
+ * A moins de SOLVE_MARGIN ms du seuil, la gigue des threads reels peut
+ * changer l'issue : le scenario reste indecis. Avec nombre_de_repas, un
+ * deces n'est sur que s'il arrive avant le premier repas de certains
+ * philos (time_to_die < time_to_eat) ; sinon les repas peuvent finir
+ * avant.
+ * 
+ * @param table Arguments lus par parse_input
+ * @param death_at Instant prevu du deces (ms) si DIES
+ * @return SURVIVES, DIES ou UNDECIDED
+ */
+t_verdict	solve(t_table *table, long *death_at)
+{
+	long	die;
+	long	needed;
+
+	die = table->time_to_die / 1e3;
+	*death_at = die + 1;
+	if (table->nbr_limit_meals == 0)
+		return (SURVIVES);
+	if (table->philo_nbr == 1)
+		return (DIES);
+	needed = solve_needed(table);
+	if (die >= needed + SOLVE_MARGIN)
+		return (SURVIVES);
+	if (die + SOLVE_MARGIN >= needed)
+		return (UNDECIDED);
+	if (table->nbr_limit_meals > 0
+		&& die + SOLVE_MARGIN >= table->time_to_eat / 1e3)
+		return (UNDECIDED);
+	return (DIES);
+}
+
+/**
+ * @brief --solve : affiche l'issue si elle est connue d'avance.
+ * 
+ * @param table Arguments lus par parse_input
+ * @return true si la simulation reelle est inutile
+ */
+bool	solve_main(t_table *table)
+{
+	long		death_at;
+	t_verdict	verdict;
+
+	verdict = solve(table, &death_at);
+	if (verdict == SURVIVES && table->nbr_limit_meals == 0)
+		printf("solver: survives (no meal to eat)\n");
+	else if (verdict == SURVIVES)
+		printf("solver: survives (time_to_die %ld >= %ld ms needed)\n",
+			table->time_to_die / 1000, solve_needed(table));
+	else if (verdict == DIES)
+		printf("solver: dies at t~%ld ms\n", death_at);
+	else
+		fprintf(stderr, "solver: undecided, running the simulation\n");
+	return (verdict != UNDECIDED);
+}
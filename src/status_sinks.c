@@ -0,0 +1,58 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   status_sinks.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 09:48:12 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/20 09:48:12 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/**
+ * @brief Sortie par defaut : une ligne printf par statut.
+ * 
+ * @param status Statut a afficher
+ * @param philo Philosophe concerne
+ * @param elapsed Temps depuis le debut de la simulation (ms)
+ */
+void	print_status(t_philo_status status, t_philo *philo, long elapsed)
+{
+	if (status == TAKE_FIRST_FORK || status == TAKE_SECOND_FORK)
+		printf("%-6ld %d has taken a fork\n", elapsed, philo->id);
+	else if (status == EATING)
+		printf("%-6ld %d is eating\n", elapsed, philo->id);
+	else if (status == SLEEPING)
+		printf("%-6ld %d is sleeping\n", elapsed, philo->id);
+	else if (status == THINKING)
+		printf("%-6ld %d is thinking\n", elapsed, philo->id);
+	else if (status == DIED)
+		printf("%-6ld %d died\n", elapsed, philo->id);
+}
+
+/**
+ * @brief Envoie une ligne de statut a la sortie choisie : callback
+ * libphilo, trace binaire (--trace), sortie rapide (--fast-output) ou
+ * printf par defaut. Appele sous write_lock.
+ * 
+ * @param table Structure principale
+ * @param philo Philosophe concerne
+ * @param status Statut a afficher
+ * @param elapsed Temps depuis le debut de la simulation (ms)
+ */
+void	emit_status(t_table *table, t_philo *philo, t_philo_status status,
+			long elapsed)
+{
+	if (table->opts.on_event)
+		table->opts.on_event(table->opts.user, elapsed, philo->id,
+			(t_philo_event)status);
+	else if (table->opts.trace_file)
+		trace_event(table, philo, status, elapsed);
+	else if (table->opts.fast_output)
+		out_status(table, philo, status, elapsed);
+	else
+		print_status(status, philo, elapsed);
+}
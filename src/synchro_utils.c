@@ -6,7 +6,7 @@
 /*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/25 11:49:00 by marguima          #+#    #+#             */
-/*   Updated: 2026/01/25 15:04:55 by marguima         ###   ########.fr       */
+/*   Updated: 2026/10/20 20:24:50 by marguima         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,15 +16,21 @@
  * @brief Attend que tous les threads soient créés et prêts.
  * 
  * Boucle active (spin wait) jusqu'à ce que le flag all_ready
- * soit mis à true. Permet de synchroniser le départ de tous
- * les philosophes au même moment.
+ * soit mis à true, ou attente bloquante avec --low-cpu.
+ * Permet de synchroniser le départ de tous les philosophes
+ * au même moment. Sondes barrier_wait et barrier_pass autour de
+ * l'attente ; barrier_release est posee par le thread qui ouvre.
  * 
  * @param table Pointeur vers la structure principale
  */
 void	wait_all_threads(t_table *table)
 {
+	PROBE0(barrier_wait);
+	if (table->opts.low_cpu)
+		wait_flag(table, &table->all_ready);
 	while (get_bool(&table->table_mutex, &table->all_ready) == false)
 		;
+	PROBE0(barrier_pass);
 }
 
 /**
@@ -0,0 +1,133 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 19:30:08 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/19 19:30:08 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+#include <fcntl.h>
+
+/* --trace=FICHIER : les statuts sont ecrits en binaire (2 a 3 octets
+par evenement au lieu de ~25) dans un tampon de TRACE_BUF octets, vide
+par write quand il est plein. philo-trace les relit. */
+
+/**
+ * @brief Encode value en varint (7 bits par octet, bit 7 = suite).
+ * 
+ * @param dst Destination (au moins 10 octets)
+ * @param value Valeur a encoder
+ * @return Nombre d'octets ecrits
+ */
+size_t	trace_varint(unsigned char *dst, unsigned long value)
+{
+	size_t	len;
+
+	len = 0;
+	while (value >= 0x80)
+	{
+		dst[len++] = (value & 0x7f) | 0x80;
+		value >>= 7;
+	}
+	dst[len++] = value;
+	return (len);
+}
+
+/**
+ * @brief Ouvre le fichier de trace et ecrit l'entete : nombre de places
+ * et les trois temps en ms, pour l'analyse hors ligne.
+ * 
+ * @param table Structure principale
+ */
+void	trace_init(t_table *table)
+{
+	t_trace	*trace;
+
+	trace = &table->trace;
+	memset(trace, 0, sizeof(t_trace));
+	if (!table->opts.trace_file)
+		return ;
+	trace->fd = open(table->opts.trace_file, O_WRONLY | O_CREAT | O_TRUNC,
+			0644);
+	if (trace->fd < 0)
+		error("Philo : cannot open --trace file.\n");
+	trace->buf = safe_malloc(TRACE_BUF);
+	memcpy(trace->buf, TRACE_MAGIC, sizeof(TRACE_MAGIC) - 1);
+	trace->len = sizeof(TRACE_MAGIC) - 1;
+	trace->len += trace_varint(trace->buf + trace->len, table->philo_cap);
+	trace->len += trace_varint(trace->buf + trace->len,
+			table->time_to_die / 1000);
+	trace->len += trace_varint(trace->buf + trace->len,
+			table->time_to_eat / 1000);
+	trace->len += trace_varint(trace->buf + trace->len,
+			table->time_to_sleep / 1000);
+}
+
+/**
+ * @brief Ajoute un evenement : ecart avec le precedent et statut dans
+ * un varint, puis l'id. Appele sous write_lock, donc les horodatages
+ * ne reculent jamais.
+ * 
+ * @param table Structure principale
+ * @param philo Philosophe concerne
+ * @param status Statut
+ * @param elapsed Temps depuis le debut de la simulation (ms)
+ */
+void	trace_event(t_table *table, t_philo *philo, t_philo_status status,
+			long elapsed)
+{
+	t_trace	*trace;
+
+	trace = &table->trace;
+	if (trace->len + 20 > TRACE_BUF)
+		trace_flush(trace);
+	if (elapsed < trace->last)
+		elapsed = trace->last;
+	trace->len += trace_varint(trace->buf + trace->len,
+			(unsigned long)(elapsed - trace->last) << 3 | status);
+	trace->len += trace_varint(trace->buf + trace->len, philo->id);
+	trace->last = elapsed;
+	if (status == DIED)
+		trace_flush(trace);
+}
+
+/**
+ * @brief Ecrit le tampon dans le fichier et le vide.
+ * 
+ * @param trace Trace ouverte
+ */
+void	trace_flush(t_trace *trace)
+{
+	size_t	done;
+	ssize_t	n;
+
+	done = 0;
+	while (done < trace->len)
+	{
+		n = write(trace->fd, trace->buf + done, trace->len - done);
+		if (n < 0 && errno != EINTR)
+			error("Philo : cannot write --trace file.\n");
+		if (n > 0)
+			done += n;
+	}
+	trace->len = 0;
+}
+
+/**
+ * @brief Vide et ferme la trace.
+ * 
+ * @param table Structure principale
+ */
+void	trace_destroy(t_table *table)
+{
+	if (!table->opts.trace_file)
+		return ;
+	trace_flush(&table->trace);
+	close(table->trace.fd);
+	free(table->trace.buf);
+}
@@ -6,7 +6,7 @@
 /*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/25 11:53:29 by marguima          #+#    #+#             */
-/*   Updated: 2026/01/27 08:40:34 by marguima         ###   ########.fr       */
+/*   Updated: 2026/10/21 11:02:14 by marguima         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -54,8 +54,14 @@ long	get_time(t_time_code timecode)
  * @brief Affiche le statut d'un philosophe de manière thread-safe.
  * 
  * Calcule le temps écoulé et affiche le message correspondant
- * au statut. Protégé par un mutex pour éviter l'entrelacement
+ * au statut via emit_status (printf, sortie rapide, trace ou callback
+ * libphilo).
+ * Protégé par un mutex pour éviter l'entrelacement
  * des messages. Ne print pas si le philo est rassasié.
+ * Publie aussi le statut dans la view du philo (snapshots, meme
+ * rassasie) et dans la page --metrics si elle existe. Le premier deces
+ * est garde dans dead_id/dead_at (resultat de philo_run). Sonde status
+ * (id, statut, ms depuis le depart) pour chaque statut, meme tardif.
  * 
  * @param status Statut actuel du philosophe
  * @param philo Pointeur vers le philosophe
@@ -64,21 +70,24 @@ void	write_status(t_philo_status status, t_philo *philo)
 {
 	long	elapsed;
 
+	if (status != DIED)
+		snapshot_publish(philo, status);
 	if (philo->full)
 		return ;
+	if (status == DIED)
+		metrics_stop(philo->table, philo);
+	else
+		metrics_publish(philo, status);
 	safe_handle_mutex(&philo->table->write_lock, LOCK);
 	elapsed = get_time(MILLISECOND) - philo->table->start_simulation;
-	if ((status == TAKE_FIRST_FORK || status == TAKE_SECOND_FORK)
-		&& !simulation_finished(philo->table))
-		printf("%-6ld %d has taken a fork\n", elapsed, philo->id);
-	else if (status == EATING && !simulation_finished(philo->table))
-		printf("%-6ld %d is eating\n", elapsed, philo->id);
-	else if (status == SLEEPING && !simulation_finished(philo->table))
-		printf("%-6ld %d is sleeping\n", elapsed, philo->id);
-	else if (status == THINKING && !simulation_finished(philo->table))
-		printf("%-6ld %d is thinking\n", elapsed, philo->id);
-	else if (status == DIED)
-		printf("%-6ld %d died\n", elapsed, philo->id);
+	PROBE3(status, philo->id, status, elapsed);
+	if (status == DIED && !philo->table->dead_id)
+	{
+		philo->table->dead_id = philo->id;
+		philo->table->dead_at = elapsed;
+	}
+	if (status == DIED || !simulation_finished(philo->table))
+		emit_status(philo->table, philo, status, elapsed);
 	safe_handle_mutex(&philo->table->write_lock, UNLOCK);
 }
 
@@ -89,6 +98,8 @@ void	write_status(t_philo_status status, t_philo *philo)
  * écoulé. Utilise usleep pour les longues périodes et une boucle
  * active pour la fin afin de maximiser la précision.
  * S'arrête immédiatement si la simulation se termine.
+ * Sondes sleep_start et sleep_end (duree demandee en us) : l'ecart
+ * entre les deux est la duree reellement dormie.
  * 
  * @param usec Durée de sommeil en microsecondes
  * @param table Pointeur vers la structure principale
@@ -100,6 +111,9 @@ void	precise_usleep(long usec, t_table *table)
 	long	remaining;
 
 	start = get_time(MICROSECOND);
+	PROBE1(sleep_start, usec);
+	if (table->opts.low_cpu)
+		sleep_until(table, start + usec);
 	while (get_time(MICROSECOND) - start < usec)
 	{
 		if (simulation_finished(table))
@@ -112,30 +126,25 @@ void	precise_usleep(long usec, t_table *table)
 			while (get_time(MICROSECOND) - start < usec)
 				;
 	}
+	PROBE1(sleep_end, usec);
+	if (table->opts.cpu_report && !simulation_finished(table))
+		cpu_record_sleep(table, get_time(MICROSECOND) - start - usec);
 }
 
 /**
  * @brief Libère toutes les ressources allouées.
  * 
- * Détruit tous les mutex (philosophes, table, write_lock)
- * et libère la mémoire allouée pour les fourchettes et
- * les philosophes.
+ * Détruit tous les mutex (philosophes, fourchettes, table, write_lock)
+ * et libère la mémoire allouée pour les fourchettes,
+ * les philosophes et la page --metrics.
  * 
  * @param table Pointeur vers la structure principale
  */
 void	clean(t_table *table)
 {
-	t_philo	*philo;
-	int		i;
-
-	i = -1;
-	while (++i < table->philo_nbr)
-	{
-		philo = table->philos + i;
-		safe_handle_mutex(&philo->philo_mutex, DESTROY);
-	}
-	safe_handle_mutex(&table->write_lock, DESTROY);
-	safe_handle_mutex(&table->table_mutex, DESTROY);
-	free(table->forks);
-	free(table->philos);
+	data_free(table);
+	table_locks_destroy(table);
+	out_destroy(table);
+	trace_destroy(table);
+	metrics_destroy(table);
 }
@@ -0,0 +1,153 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   soak.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 15:02:48 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 12:40:11 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "soak.h"
+
+/* Suite de soak (make test) : chaque scenario tourne au calme puis sous
+charge (un thread qui tourne a vide par coeur), via libphilo, dans son
+propre mode : attente active (spin) ou --low-cpu. Les scenarios a duree
+ont des repas illimites et sont arretes par philo_stop. Les seuils sont
+dans soak_gates ; le code de retour est non nul si un scenario echoue.
+Usage : ./tests/soak [tours] */
+
+/* philos, die, eat, sleep, repas, --low-cpu, duree (ms, 0 = jusqu'au
+dernier repas ou au deces). Pas de scenario a 1000 places en attente
+active : sous charge, sur un seul coeur, 1000 threads qui tournent a
+vide font monter le p99 a 160-220 ms, au-dela de la moitie de la marge
+(voir soak_limits), et tuent parfois un philo. */
+static const long	g_scenarios[][7] = {
+{1, 800, 200, 200, -1, 0, 0},
+{4, 410, 200, 200, 10, 0, 0},
+{5, 800, 200, 200, 10, 0, 0},
+{4, 310, 200, 100, -1, 0, 0},
+{5, 800, 200, 200, 10, 1, 0},
+{200, 800, 200, 200, 5, 0, 0},
+{200, 800, 200, 200, 5, 1, 0},
+{200, 800, 200, 200, -1, 0, 10000},
+{200, 800, 200, 200, -1, 1, 10000},
+{1000, 800, 200, 200, 3, 1, 0},
+{1000, 800, 200, 200, -1, 1, 10000},
+{0, 0, 0, 0, 0, 0, 0}};
+
+/**
+ * @brief Un scenario, affiche sur une ligne, dans le mode de sa ligne
+ * de g_scenarios.
+ * 
+ * @return true si tous les seuils passent
+ */
+bool	soak_run(t_philo_sim *sim, t_soak *s, const long *row, bool loaded)
+{
+	t_philo_result	res;
+	char			*failed;
+	t_philo_err		err;
+
+	s->config.philo_nbr = row[0];
+	s->config.time_to_die = row[1];
+	s->config.time_to_eat = row[2];
+	s->config.time_to_sleep = row[3];
+	s->config.nbr_limit_meals = row[4];
+	s->config.low_cpu = row[5];
+	s->duration = row[6];
+	s->config.on_event = soak_event;
+	s->config.user = s;
+	soak_prepare(s, loaded);
+	err = philo_configure(sim, &s->config);
+	if (err == PHILO_OK)
+		err = philo_run(sim, &res);
+	if (err != PHILO_OK)
+		error((char *)philo_strerror(err));
+	failed = soak_gates(s);
+	soak_print(s, loaded, failed);
+	return (failed == NULL);
+}
+
+/**
+ * @brief Un tour : chaque scenario au calme, puis sous charge.
+ * 
+ * @return Nombre d'echecs
+ */
+long	soak_round(t_philo_sim *sim, t_soak *s, pthread_t *threads)
+{
+	static atomic_bool	stop;
+	long				i;
+	long				failures;
+
+	failures = 0;
+	i = -1;
+	while (g_scenarios[++i][0])
+	{
+		failures += !soak_run(sim, s, g_scenarios[i], false);
+		soak_contention(threads, &stop, sysconf(_SC_NPROCESSORS_ONLN));
+		failures += !soak_run(sim, s, g_scenarios[i], true);
+		soak_contention(threads, &stop, 0);
+	}
+	return (failures);
+}
+
+/**
+ * @brief Une ligne par scenario : parametres, mode, mesures, la duree
+ * pour un scenario arrete par philo_stop, et le seuil depasse s'il y en
+ * a un.
+ */
+void	soak_print(t_soak *s, bool loaded, char *failed)
+{
+	char	*result;
+	char	*mode;
+	char	*load;
+
+	result = "PASS";
+	if (failed)
+		result = "FAIL";
+	mode = "spin";
+	if (s->config.low_cpu)
+		mode = "low-cpu";
+	load = "quiet";
+	if (loaded)
+		load = "loaded";
+	printf("%s %5ld %ld %ld %ld %3ld %-7s %-6s died %-4d delay %3ld ms "
+		"jitter p99 %3ld ms", result, s->config.philo_nbr,
+		s->config.time_to_die, s->config.time_to_eat, s->config.time_to_sleep,
+		s->config.nbr_limit_meals, mode, load, s->dead_id, s->death_delay,
+		s->jitter);
+	if (s->duration)
+		printf("  stopped at %ld s", s->duration / 1000);
+	if (failed)
+		printf("  <- %s", failed);
+	printf("\n");
+}
+
+int	main(int ac, char **av)
+{
+	t_philo_sim	*sim;
+	t_soak		s;
+	pthread_t	*threads;
+	long		rounds;
+	long		failures;
+
+	rounds = 1;
+	if (ac > 1)
+		rounds = atol(av[1]);
+	threads = safe_malloc(sizeof(pthread_t) * sysconf(_SC_NPROCESSORS_ONLN));
+	memset(&s, 0, sizeof(t_soak));
+	if (philo_create(&sim) != PHILO_OK)
+		error("soak : philo_create failed\n");
+	s.sim = sim;
+	failures = 0;
+	while (rounds-- > 0)
+		failures += soak_round(sim, &s, threads);
+	philo_destroy(sim);
+	free(s.gaps);
+	free(threads);
+	printf("soak: %ld failure(s)\n", failures);
+	return (failures != 0);
+}
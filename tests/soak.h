@@ -0,0 +1,59 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   soak.h                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/21 11:20:40 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 12:40:11 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#ifndef SOAK_H
+# define SOAK_H
+
+# include "philo.h"
+
+# define SOAK_DEATH_MAX 10
+# define SOAK_JITTER_MAX 20
+# define SOAK_JITTER_SEAT_US 80
+# define SOAK_LOADED_MARGIN 50
+
+/* SOAK : un scenario de tests/soak et ce que le callback en a vu */
+typedef struct s_soak
+{
+	t_philo_config	config;
+	t_philo_sim		*sim; // Pour philo_stop depuis le callback
+	long			duration; // Arret du run (ms), 0 = jusqu'a la fin
+	t_verdict		verdict; // Issue prevue par solve
+	long			needed; // Periode entre deux repas (solve_needed)
+	long			*last_eat; // Dernier repas par id, -1 si aucun
+	long			*gaps; // Ecarts entre deux repas consecutifs (ms)
+	long			gap_count;
+	long			gap_cap;
+	int				dead_id;
+	long			death_delay; // Ligne "died" apres l'echeance (ms)
+	long			jitter; // p99 des ecarts - needed (ms)
+	long			jitter_max; // Seuil du p99 (soak_prepare)
+}	t_soak;
+
+/* SOAK_LOAD */
+void	*soak_load(void *data);
+void	soak_contention(pthread_t *threads, atomic_bool *stop, long count);
+
+/* SOAK_CHECK */
+void	soak_event(void *user, long time_ms, int id, t_philo_event event);
+void	soak_gap(t_soak *s, long gap);
+void	soak_prepare(t_soak *s, bool loaded);
+
+/* SOAK_GATES */
+void	soak_limits(t_soak *s, bool loaded);
+int	soak_cmp(const void *a, const void *b);
+char	*soak_gates(t_soak *s);
+
+/* SOAK */
+void	soak_print(t_soak *s, bool loaded, char *failed);
+
+#endif
@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   soak_check.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 15:10:27 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 12:40:11 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "soak.h"
+
+/* Mesures de tests/soak. Le callback libphilo voit chaque
+statut sous write_lock : il garde le dernier repas de chaque philo, les
+ecarts entre deux repas consecutifs et le retard de la ligne "died". */
+
+/**
+ * @brief Callback libphilo des scenarios de soak. Un scenario a duree
+ * (repas illimites) est arrete par philo_stop au premier statut qui
+ * depasse sa duree : les statuts arrivent en continu, l'arret tombe a
+ * quelques ms pres.
+ */
+void	soak_event(void *user, long time_ms, int id, t_philo_event event)
+{
+	t_soak	*s;
+	long	last;
+
+	s = (t_soak *)user;
+	last = s->last_eat[id];
+	if (s->duration > 0 && time_ms >= s->duration)
+		philo_stop(s->sim);
+	if (event == PHILO_DIED)
+	{
+		if (last < 0)
+			last = 0;
+		s->dead_id = id;
+		s->death_delay = time_ms - (last + s->config.time_to_die + 1);
+	}
+	if (event != PHILO_EATING)
+		return ;
+	if (last >= 0)
+		soak_gap(s, time_ms - last);
+	s->last_eat[id] = time_ms;
+}
+
+/**
+ * @brief Ajoute un ecart entre deux repas, en agrandissant le tableau
+ * si besoin.
+ */
+void	soak_gap(t_soak *s, long gap)
+{
+	if (s->gap_count == s->gap_cap)
+	{
+		s->gap_cap = s->gap_cap * 2 + 1024;
+		s->gaps = realloc(s->gaps, sizeof(long) * s->gap_cap);
+		if (!s->gaps)
+			error("soak : malloc error\n");
+	}
+	s->gaps[s->gap_count++] = gap;
+}
+
+/**
+ * @brief Remet les mesures a zero, demande a solve l'issue attendue et
+ * fixe les seuils (soak_limits).
+ * 
+ * @param s Scenario (config remplie)
+ * @param loaded true si les threads de charge tournent
+ */
+void	soak_prepare(t_soak *s, bool loaded)
+{
+	t_table	table;
+	long	death_at;
+	long	i;
+
+	memset(&table, 0, sizeof(t_table));
+	table.philo_nbr = s->config.philo_nbr;
+	table.time_to_die = s->config.time_to_die * MS_TO_US;
+	table.time_to_eat = s->config.time_to_eat * MS_TO_US;
+	table.time_to_sleep = s->config.time_to_sleep * MS_TO_US;
+	table.nbr_limit_meals = s->config.nbr_limit_meals;
+	s->verdict = solve(&table, &death_at);
+	s->needed = solve_needed(&table);
+	s->last_eat = safe_malloc(sizeof(long) * (s->config.philo_nbr + 1));
+	i = -1;
+	while (++i <= s->config.philo_nbr)
+		s->last_eat[i] = -1;
+	s->gap_count = 0;
+	s->dead_id = 0;
+	s->death_delay = 0;
+	s->jitter = 0;
+	soak_limits(s, loaded);
+}
@@ -0,0 +1,84 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   soak_gates.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/21 12:14:26 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 12:40:11 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "soak.h"
+
+/* Seuils de tests/soak : ce qu'un scenario doit respecter, au calme et
+sous charge. */
+
+/**
+ * @brief Fixe le seuil de gigue et, sous charge, l'issue verifiee.
+ * 
+ * @details Au calme, sur un seul coeur, la moitie paire de la table se
+ * reveille au meme instant et passe un par un : chaque place ajoute au
+ * retard du dernier servi un changement de contexte, ses fourchettes
+ * et sa ligne de statut. D'ou SOAK_JITTER_MAX + 80 us par place : 20 ms
+ * a 5 places, 36 ms a 200, 100 ms a 1000.
+ * Sous charge, le thread de charge prend le coeur a des instants
+ * arbitraires et le p99 depend surtout de l'ordonnanceur (de 20 a
+ * 110 ms d'un run a l'autre a 1000 places) : le seuil devient la
+ * moitie de la marge avant la mort (time_to_die - needed). Une marge
+ * de moins de SOAK_LOADED_MARGIN ms ne couvre plus une tranche de
+ * l'ordonnanceur : comme solve a moins de SOLVE_MARGIN, le scenario
+ * devient indecis et seul le retard d'un eventuel "died" est verifie.
+ * 
+ * @param s Scenario (verdict et needed remplis)
+ * @param loaded true si les threads de charge tournent
+ */
+void	soak_limits(t_soak *s, bool loaded)
+{
+	long	margin;
+
+	margin = s->config.time_to_die - s->needed;
+	s->jitter_max = SOAK_JITTER_MAX
+		+ s->config.philo_nbr * SOAK_JITTER_SEAT_US / 1000;
+	if (!loaded)
+		return ;
+	if (margin / 2 > s->jitter_max)
+		s->jitter_max = margin / 2;
+	if (s->verdict == SURVIVES && margin < SOAK_LOADED_MARGIN)
+		s->verdict = UNDECIDED;
+}
+
+int	soak_cmp(const void *a, const void *b)
+{
+	return ((*(long *)a > *(long *)b) - (*(long *)a < *(long *)b));
+}
+
+/**
+ * @brief Applique les seuils : ligne "died" au plus SOAK_DEATH_MAX ms
+ * apres l'echeance, aucun deces si solve prevoit SURVIVES (et un deces
+ * s'il prevoit DIES), p99 des ecarts entre repas au plus jitter_max ms
+ * au-dessus de la periode attendue.
+ * 
+ * @param s Scenario termine
+ * @return NULL si tout passe, sinon le seuil depasse
+ */
+char	*soak_gates(t_soak *s)
+{
+	free(s->last_eat);
+	if (s->gap_count > 0)
+	{
+		qsort(s->gaps, s->gap_count, sizeof(long), soak_cmp);
+		s->jitter = s->gaps[s->gap_count * 99 / 100] - s->needed;
+	}
+	if (s->dead_id && s->death_delay > SOAK_DEATH_MAX)
+		return ("death reported late");
+	if (s->verdict == SURVIVES && s->dead_id)
+		return ("feasible scenario killed a philosopher");
+	if (s->verdict == DIES && !s->dead_id)
+		return ("expected death did not happen");
+	if (s->verdict == SURVIVES && s->jitter > s->jitter_max)
+		return ("p99 meal-gap jitter over the limit");
+	return (NULL);
+}
@@ -0,0 +1,52 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   soak_load.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/21 11:24:09 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 12:40:11 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "soak.h"
+
+/* Charge de fond de tests/soak : un thread par coeur qui tourne a vide,
+a la meme priorite que les philosophes. */
+
+/**
+ * @brief Thread de charge : occupe un coeur jusqu'a ce que stop passe
+ * a true.
+ */
+void	*soak_load(void *data)
+{
+	atomic_bool	*stop;
+
+	stop = (atomic_bool *)data;
+	while (!atomic_load_explicit(stop, memory_order_relaxed))
+		;
+	return (NULL);
+}
+
+/**
+ * @brief Lance (count > 0) ou arrete (count == 0) les threads de charge.
+ * 
+ * @param threads Un pthread_t par coeur
+ * @param stop Drapeau partage avec soak_load
+ * @param count Nombre de threads a lancer, 0 pour arreter
+ */
+void	soak_contention(pthread_t *threads, atomic_bool *stop, long count)
+{
+	static long	running;
+	long		i;
+
+	i = -1;
+	atomic_store(stop, count == 0);
+	while (count == 0 && ++i < running)
+		safe_thread_handle(threads + i, NULL, NULL, JOIN);
+	while (++i < count)
+		safe_thread_handle(threads + i, soak_load, stop, CREATE);
+	running = count;
+}
@@ -0,0 +1,162 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   philo_top.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:26:52 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/21 13:44:52 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+
+/* philo-top : lecteur de la page --metrics. Ne prend aucun verrou de la
+simulation, chaque ligne est copiee sous seqlock cote lecteur. */
+
+#define TOP_REFRESH_US 500000
+
+/**
+ * @brief Attache le segment shm en lecture seule et en deduit le
+ * nombre de lignes reellement mappees : philo_nbr vient de la page et
+ * ne doit jamais faire lire au-dela.
+ * 
+ * @param name Nom du segment (ex: /philo_metrics)
+ * @param cap Nombre de lignes que contient le mapping, en sortie
+ * @return La page mappee, ou NULL si elle n'existe pas encore
+ */
+t_metrics	*top_attach(char *name, long *cap)
+{
+	int			fd;
+	struct stat	st;
+	t_metrics	*page;
+
+	fd = shm_open(name, O_RDONLY, 0);
+	if (fd < 0)
+		return (NULL);
+	page = MAP_FAILED;
+	if (fstat(fd, &st) == 0 && st.st_size >= (off_t) sizeof(t_metrics))
+		page = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	if (page != MAP_FAILED)
+		*cap = (st.st_size - sizeof(t_metrics)) / sizeof(t_metrics_slot);
+	close(fd);
+	if (page == MAP_FAILED)
+		return (NULL);
+	while (atomic_load_explicit(&page->magic, memory_order_acquire)
+		!= METRICS_MAGIC)
+		usleep(1000);
+	return (page);
+}
+
+/**
+ * @brief Copie une ligne de maniere coherente (boucle seqlock).
+ * 
+ * @param slot Ligne partagee
+ * @param out Copie locale
+ */
+void	top_read_slot(t_metrics_slot *slot, long out[4])
+{
+	unsigned int	s;
+	bool			retry;
+
+	retry = true;
+	while (retry)
+	{
+		s = seq_read_begin(&slot->seq);
+		out[0] = atomic_load_explicit(&slot->state, memory_order_relaxed);
+		out[1] = atomic_load_explicit(&slot->meals, memory_order_relaxed);
+		out[2] = atomic_load_explicit(&slot->last_meal,
+				memory_order_relaxed);
+		out[3] = atomic_load_explicit(&slot->fork_wait,
+				memory_order_relaxed);
+		retry = seq_read_retry(&slot->seq, s);
+	}
+}
+
+/**
+ * @brief Affiche une ligne du tableau pour un philosophe. L'etat vient
+ * d'une memoire partagee qu'on ne controle pas : hors des valeurs
+ * connues, il s'affiche "unknown".
+ * 
+ * @param page Page partagee
+ * @param i Index du philosophe
+ * @param now Temps ecoule depuis le debut de la simulation (ms)
+ */
+void	top_print_slot(t_metrics *page, long i, long now)
+{
+	static char	*states[] = {"eating", "sleeping", "thinking",
+		"has 1 fork", "has 2 forks", "died", "unknown"};
+	long		v[4];
+
+	top_read_slot(&page->slots[i], v);
+	if (v[0] < EATING || v[0] > DIED)
+		v[0] = DIED + 1;
+	if (atomic_load(&page->dead_id) == page->slots[i].id)
+		v[0] = DIED;
+	printf("%5d  %-12s %8ld %12ld %14.1f\n", page->slots[i].id,
+		states[v[0]], v[1], now - v[2], v[3] / 1e3);
+}
+
+/**
+ * @brief Redessine l'ecran complet. Le nombre de lignes lu dans la page
+ * est borne par cap (top_attach).
+ * 
+ * @param page Page partagee
+ * @param name Nom du segment
+ * @param cap Nombre de lignes mappees
+ */
+void	top_render(t_metrics *page, char *name, long cap)
+{
+	struct timeval	tv;
+	long			now;
+	long			n;
+	long			i;
+	char			*state;
+
+	n = atomic_load(&page->philo_nbr);
+	if (n > cap)
+		n = cap;
+	state = "ended";
+	if (atomic_load(&page->running))
+		state = "running";
+	gettimeofday(&tv, NULL);
+	now = tv.tv_sec * 1000 + tv.tv_usec / 1000
+		- atomic_load(&page->start_simulation);
+	printf("\033[H\033[2Jphilo-top  %s  t=%ld ms  N=%ld  %ld/%ld/%ld  [%s]\n\n",
+		name, now, n, page->time_to_die, page->time_to_eat,
+		page->time_to_sleep, state);
+	printf("%5s  %-12s %8s %12s %14s\n", "ID", "STATE", "MEALS",
+		"SINCE MEAL", "FORK WAIT ms");
+	i = -1;
+	while (++i < n)
+		top_print_slot(page, i, now);
+	fflush(stdout);
+}
+
+int	main(int ac, char **av)
+{
+	char		*name;
+	t_metrics	*page;
+	long		cap;
+
+	name = METRICS_DEFAULT;
+	if (ac > 1)
+		name = av[1];
+	page = top_attach(name, &cap);
+	while (!page)
+	{
+		usleep(TOP_REFRESH_US);
+		page = top_attach(name, &cap);
+	}
+	while (atomic_load(&page->running))
+	{
+		top_render(page, name, cap);
+		usleep(TOP_REFRESH_US);
+	}
+	top_render(page, name, cap);
+	return (0);
+}
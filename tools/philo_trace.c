@@ -0,0 +1,126 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   philo_trace.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 19:52:33 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/19 19:52:33 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/* philo-trace : relit un fichier --trace.
+  philo-trace decode FICHIER  -> le texte exact qu'aurait ecrit printf
+  philo-trace stats FICHIER   -> ecarts entre repas et tenue des fourchettes */
+
+/**
+ * @brief Lit un varint a la position courante.
+ * 
+ * @return false a la fin du fichier (ou sur un varint tronque)
+ */
+bool	trace_varint_get(t_trace_reader *r, unsigned long *value)
+{
+	int	shift;
+
+	*value = 0;
+	shift = 0;
+	while (r->pos < r->size && shift < 64)
+	{
+		*value |= (unsigned long)(r->buf[r->pos] & 0x7f) << shift;
+		if (!(r->buf[r->pos++] & 0x80))
+			return (true);
+		shift += 7;
+	}
+	return (false);
+}
+
+/**
+ * @brief Charge le fichier et lit l'entete.
+ * 
+ * @param path Chemin du fichier --trace
+ * @param r Lecteur a initialiser
+ * @return false si le fichier est illisible ou n'est pas une trace
+ */
+bool	trace_open(char *path, t_trace_reader *r)
+{
+	FILE	*f;
+	long	size;
+
+	memset(r, 0, sizeof(t_trace_reader));
+	f = fopen(path, "rb");
+	if (!f || fseek(f, 0, SEEK_END) != 0)
+		return (false);
+	size = ftell(f);
+	rewind(f);
+	r->buf = malloc(size + 1);
+	if (!r->buf || fread(r->buf, 1, size, f) != (size_t)size)
+		size = 0;
+	fclose(f);
+	r->size = size;
+	r->pos = sizeof(TRACE_MAGIC) - 1;
+	if (r->size < r->pos || memcmp(r->buf, TRACE_MAGIC, r->pos) != 0)
+		return (false);
+	return (trace_varint_get(r, (unsigned long *)&r->cap)
+		&& trace_varint_get(r, (unsigned long *)&r->die)
+		&& trace_varint_get(r, (unsigned long *)&r->eat)
+		&& trace_varint_get(r, (unsigned long *)&r->sleep));
+}
+
+/**
+ * @brief Lit l'evenement suivant et reconstruit son horodatage.
+ * 
+ * @return false a la fin de la trace
+ */
+bool	trace_next(t_trace_reader *r, t_trace_event *ev)
+{
+	unsigned long	head;
+	unsigned long	id;
+
+	if (!trace_varint_get(r, &head) || !trace_varint_get(r, &id))
+		return (false);
+	r->time += head >> 3;
+	ev->time = r->time;
+	ev->status = head & 7;
+	ev->id = id;
+	return (ev->status <= DIED);
+}
+
+/**
+ * @brief Reecrit la trace au format texte de print_status.
+ * 
+ * @param r Lecteur ouvert
+ */
+void	trace_decode(t_trace_reader *r)
+{
+	static const char	*actions[] = {"is eating", "is sleeping",
+		"is thinking", "has taken a fork", "has taken a fork", "died"};
+	t_trace_event		ev;
+
+	while (trace_next(r, &ev))
+		printf("%-6ld %ld %s\n", ev.time, ev.id, actions[ev.status]);
+}
+
+int	main(int ac, char **av)
+{
+	t_trace_reader	r;
+
+	if (ac != 3 || (strcmp(av[1], "decode") && strcmp(av[1], "stats")))
+	{
+		fprintf(stderr, "Usage: philo-trace decode|stats FILE\n");
+		return (1);
+	}
+	if (!trace_open(av[2], &r))
+	{
+		fprintf(stderr, "philo-trace: %s is not a --trace file\n", av[2]);
+		return (1);
+	}
+	if (strcmp(av[1], "decode") == 0)
+		trace_decode(&r);
+	else
+		trace_stats(&r);
+	free(r.buf);
+	return (0);
+}
@@ -0,0 +1,128 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   philo_trace_stats.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marguima <marguima@student.42lausanne.c    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 20:07:45 by marguima          #+#    #+#             */
+/*   Updated: 2026/10/19 20:07:45 by marguima         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/**
+ * @brief Ajoute une mesure a un accumulateur {somme, nombre, max}.
+ */
+void	stats_record(long acc[3], long value)
+{
+	acc[0] += value;
+	acc[1]++;
+	if (value > acc[2])
+		acc[2] = value;
+}
+
+/**
+ * @brief Suit les fourchettes d'un philo : elles sont rendues juste
+ * avant "is sleeping" (release_forks).
+ */
+void	stats_forks(t_trace_stats *st, t_trace_event *ev)
+{
+	if (ev->status == TAKE_FIRST_FORK)
+		st->take1[ev->id] = ev->time;
+	else if (ev->status == TAKE_SECOND_FORK && st->take1[ev->id] >= 0)
+	{
+		st->take2[ev->id] = ev->time;
+		stats_record(st->wait2, ev->time - st->take1[ev->id]);
+	}
+	else if (ev->status == SLEEPING && st->take2[ev->id] >= 0)
+	{
+		stats_record(st->hold1, ev->time - st->take1[ev->id]);
+		stats_record(st->hold2, ev->time - st->take2[ev->id]);
+		st->take1[ev->id] = -1;
+		st->take2[ev->id] = -1;
+	}
+}
+
+/**
+ * @brief Met a jour les mesures avec un evenement.
+ */
+void	stats_event(t_trace_stats *st, t_trace_event *ev)
+{
+	st->events++;
+	st->end_time = ev->time;
+	if (ev->status == DIED)
+		st->death_id = ev->id;
+	if (ev->status != EATING)
+	{
+		stats_forks(st, ev);
+		return ;
+	}
+	if (st->last_meal[ev->id] >= 0
+		&& ev->time - st->last_meal[ev->id] > st->gap[2])
+		st->gap_worst = ev->id;
+	if (st->last_meal[ev->id] >= 0)
+		stats_record(st->gap, ev->time - st->last_meal[ev->id]);
+	st->last_meal[ev->id] = ev->time;
+}
+
+/**
+ * @brief Affiche le resume de l'analyse.
+ */
+void	stats_print(t_trace_reader *r, t_trace_stats *st)
+{
+	printf("%ld events in %zu bytes (%.2f bytes/event), %ld ms, "
+		"%ld seats, die %ld eat %ld sleep %ld\n", st->events, r->size,
+		r->size / (st->events + 1e-9), st->end_time, r->cap, r->die,
+		r->eat, r->sleep);
+	if (st->gap[1] == 0)
+		printf("meal gap: no philo ate twice\n");
+	else
+		printf("meal gap: avg %ld ms, max %ld ms (philo %ld), margin %ld ms\n",
+			st->gap[0] / st->gap[1], st->gap[2], st->gap_worst,
+			r->die - st->gap[2]);
+	printf("first fork held: avg %ld ms, max %ld ms\n",
+		st->hold1[0] / (st->hold1[1] + !st->hold1[1]), st->hold1[2]);
+	printf("second fork held: avg %ld ms, max %ld ms\n",
+		st->hold2[0] / (st->hold2[1] + !st->hold2[1]), st->hold2[2]);
+	printf("wait for second fork: avg %ld ms, max %ld ms\n",
+		st->wait2[0] / (st->wait2[1] + !st->wait2[1]), st->wait2[2]);
+	if (st->death_id > 0)
+		printf("philo %ld died at %ld ms\n", st->death_id, st->end_time);
+}
+
+/**
+ * @brief philo-trace stats : ecarts entre deux repas consecutifs et
+ * duree de tenue des fourchettes, en un seul passage sur la trace
+ * binaire. Le premier repas n'a pas d'ecart : la trace ne dit pas
+ * quand le thread du philo a demarre.
+ * 
+ * @param r Lecteur ouvert
+ */
+void	trace_stats(t_trace_reader *r)
+{
+	t_trace_stats	st;
+	t_trace_event	ev;
+	long			i;
+
+	memset(&st, 0, sizeof(t_trace_stats));
+	st.last_meal = malloc((r->cap + 1) * sizeof(long));
+	st.take1 = malloc((r->cap + 1) * sizeof(long));
+	st.take2 = malloc((r->cap + 1) * sizeof(long));
+	if (!st.last_meal || !st.take1 || !st.take2)
+		return ;
+	i = -1;
+	while (++i <= r->cap)
+	{
+		st.last_meal[i] = -1;
+		st.take1[i] = -1;
+		st.take2[i] = -1;
+	}
+	while (trace_next(r, &ev) && ev.id >= 1 && ev.id <= r->cap)
+		stats_event(&st, &ev);
+	stats_print(r, &st);
+	free(st.last_meal);
+	free(st.take1);
+	free(st.take2);
+}